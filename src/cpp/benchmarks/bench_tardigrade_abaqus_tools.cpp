@@ -0,0 +1,910 @@
+/**
+  * \file bench_tardigrade_abaqus_tools.cpp
+  *
+  * Performance benchmarks for the c++ library of tardigrade_abaqus_tools
+  *
+  * Every benchmark reports the time per call and the heap allocations per call. Write JSON results for comparisons
+  * between releases with ``--benchmark_out=<file> --benchmark_out_format=json``.
+  */
+
+#include<atomic>
+#include<cmath>
+#include<cstdlib>
+#include<new>
+
+#include<benchmark/benchmark.h>
+
+#include<tardigrade_abaqus_tools.h>
+
+//Count every global heap allocation to report allocations per call. The replacements are not inlined so the compiler
+//doesn't pair the inlined malloc/free with the new/delete expressions.
+static std::atomic< long long > allocation_count( 0 );
+
+__attribute__(( noinline )) void *operator new( std::size_t size ){
+    allocation_count.fetch_add( 1, std::memory_order_relaxed );
+    if ( void *pointer = std::malloc( size ? size : 1 ) ){
+        return pointer;
+    }
+    throw std::bad_alloc( );
+}
+
+__attribute__(( noinline )) void operator delete( void *pointer ) noexcept{
+    std::free( pointer );
+}
+
+__attribute__(( noinline )) void operator delete( void *pointer, std::size_t ) noexcept{
+    std::free( pointer );
+}
+
+template< class Function >
+static void countAllocations( benchmark::State &state, Function &&function ){
+    /*!
+     * Report the heap allocations made by a single, untimed call of the benchmarked function
+     *
+     * \param &state: The benchmark state
+     * \param &&function: The benchmarked function
+     */
+    const long long start = allocation_count.load( std::memory_order_relaxed );
+    function( );
+    const long long allocations = allocation_count.load( std::memory_order_relaxed ) - start;
+    state.counters[ "allocs/call" ] = benchmark::Counter( allocations );
+}
+
+static void NTENSArguments( benchmark::internal::Benchmark *benchmark ){
+    /*!
+     * The NDI and NSHR combinations of 3D, plane strain/axisymmetric, and plane stress elements
+     */
+    benchmark->ArgNames( { "NDI", "NSHR" } );
+    benchmark->Args( { 3, 3 } )->Args( { 3, 1 } )->Args( { 2, 1 } );
+}
+
+static void NTENSSymmetricArguments( benchmark::internal::Benchmark *benchmark ){
+    /*!
+     * The NDI and NSHR combinations for general (0) and major symmetric (1) tangents
+     */
+    benchmark->ArgNames( { "NDI", "NSHR", "symmetric" } );
+    for ( int symmetric = 0; symmetric <= 1; symmetric++ ){
+        benchmark->Args( { 3, 3, symmetric } )->Args( { 3, 1, symmetric } )->Args( { 2, 1, symmetric } );
+    }
+}
+
+static void NTENSSolverArguments( benchmark::internal::Benchmark *benchmark ){
+    /*!
+     * The NDI and NSHR combinations for both Abaqus/Standard (1) and Abaqus/Explicit (0) packing
+     */
+    benchmark->ArgNames( { "NDI", "NSHR", "standard" } );
+    for ( int standard : { 1, 0 } ){
+        benchmark->Args( { 3, 3, standard } )->Args( { 3, 1, standard } )->Args( { 2, 1, standard } );
+    }
+}
+
+static void BlockArguments( benchmark::internal::Benchmark *benchmark ){
+    /*!
+     * VUMAT block sizes for both Abaqus/Standard (1) and Abaqus/Explicit (0) packing
+     */
+    benchmark->ArgNames( { "nblock", "standard" } );
+    for ( int standard : { 1, 0 } ){
+        for ( int nblock = 1; nblock <= 4096; nblock *= 8 ){
+            benchmark->Args( { nblock, standard } );
+        }
+    }
+}
+
+static void ShapeArguments( benchmark::internal::Benchmark *benchmark ){
+    /*!
+     * Array shapes from single UMAT state variable arrays to large VUMAT state blocks
+     */
+    benchmark->ArgNames( { "height", "width" } );
+    benchmark->Args( { 1, 20 } )->Args( { 6, 6 } )->Args( { 1, 500 } )->Args( { 64, 100 } )->Args( { 512, 200 } )->Args( { 4096, 400 } );
+}
+
+static std::vector< double > abaqusVector( const int &size ){
+    std::vector< double > vector( size );
+    for ( int index = 0; index < size; index++ ){
+        vector[ index ] = index + 1.5;
+    }
+    return vector;
+}
+
+//=================================================================================== ROW AND COLUMN MAJOR CONVERSIONS ===
+static void BM_ColumnToRowMajor( benchmark::State &state ){
+    const int height = state.range( 0 );
+    const int width = state.range( 1 );
+    std::vector< double > column_major = abaqusVector( height * width );
+    auto call = [ & ]( ){
+        benchmark::DoNotOptimize( tardigradeAbaqusTools::columnToRowMajor( column_major.data( ), height, width ) );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+    state.SetBytesProcessed( state.iterations( ) * 2 * height * width * sizeof( double ) );
+}
+BENCHMARK( BM_ColumnToRowMajor )->Apply( ShapeArguments );
+
+static void BM_ColumnToRowMajorPointer( benchmark::State &state ){
+    const int height = state.range( 0 );
+    const int width = state.range( 1 );
+    std::vector< double > column_major = abaqusVector( height * width );
+    std::vector< double > row_major( height * width );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::columnToRowMajor( column_major.data( ), row_major.data( ), height, width );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+    state.SetBytesProcessed( state.iterations( ) * 2 * height * width * sizeof( double ) );
+}
+BENCHMARK( BM_ColumnToRowMajorPointer )->Apply( ShapeArguments );
+
+static void BM_RowToColumnMajor( benchmark::State &state ){
+    const int height = state.range( 0 );
+    const int width = state.range( 1 );
+    std::vector< double > row_major = abaqusVector( height * width );
+    std::vector< double > column_major( height * width );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::rowToColumnMajor( column_major.data( ), row_major, height, width );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+    state.SetBytesProcessed( state.iterations( ) * 2 * height * width * sizeof( double ) );
+}
+BENCHMARK( BM_RowToColumnMajor )->Apply( ShapeArguments );
+
+static void BM_RowToColumnMajorVectorOfVectors( benchmark::State &state ){
+    const int height = state.range( 0 );
+    const int width = state.range( 1 );
+    std::vector< double > column_major = abaqusVector( height * width );
+    std::vector< std::vector< double > > row_major = tardigradeAbaqusTools::columnToRowMajor( column_major.data( ), height, width );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::rowToColumnMajor( column_major.data( ), row_major, height, width );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+    state.SetBytesProcessed( state.iterations( ) * 2 * height * width * sizeof( double ) );
+}
+BENCHMARK( BM_RowToColumnMajorVectorOfVectors )->Apply( ShapeArguments );
+
+//======================================================================================== NTENS VECTOR CONVERSIONS ===
+static void BM_ExpandAbaqusNTENSVector( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    std::vector< double > abaqus_vector = abaqusVector( NDI + NSHR );
+    auto call = [ & ]( ){
+        benchmark::DoNotOptimize( tardigradeAbaqusTools::expandAbaqusNTENSVector( abaqus_vector, NDI, NSHR ) );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_ExpandAbaqusNTENSVector )->Apply( NTENSArguments );
+
+static void BM_ExpandAbaqusNTENSVectorArray( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    std::array< double, 6 > abaqus_vector = { 1, 2, 3, 4, 5, 6 };
+    auto call = [ & ]( ){
+        benchmark::DoNotOptimize( abaqus_vector );
+        benchmark::DoNotOptimize( tardigradeAbaqusTools::expandAbaqusNTENSVector( abaqus_vector, NDI, NSHR ) );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_ExpandAbaqusNTENSVectorArray )->Apply( NTENSArguments );
+
+template< int NDI, int NSHR >
+static void BM_ExpandAbaqusNTENSVectorCompileTime( benchmark::State &state ){
+    std::array< double, 6 > abaqus_vector = { 1, 2, 3, 4, 5, 6 };
+    auto call = [ & ]( ){
+        benchmark::DoNotOptimize( abaqus_vector );
+        benchmark::DoNotOptimize( tardigradeAbaqusTools::expandAbaqusNTENSVector< NDI, NSHR >( abaqus_vector ) );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK_TEMPLATE( BM_ExpandAbaqusNTENSVectorCompileTime, 3, 3 );
+BENCHMARK_TEMPLATE( BM_ExpandAbaqusNTENSVectorCompileTime, 3, 1 );
+BENCHMARK_TEMPLATE( BM_ExpandAbaqusNTENSVectorCompileTime, 2, 1 );
+
+static void BM_ContractAbaqusNTENSVector( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    std::vector< double > full_abaqus_vector = abaqusVector( 6 );
+    auto call = [ & ]( ){
+        benchmark::DoNotOptimize( tardigradeAbaqusTools::contractAbaqusNTENSVector( full_abaqus_vector, NDI, NSHR ) );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_ContractAbaqusNTENSVector )->Apply( NTENSArguments );
+
+static void BM_ExpandFullNTENSTensor( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    const bool abaqus_standard = state.range( 2 );
+    std::vector< double > abaqus_vector = abaqusVector( NDI + NSHR );
+    auto call = [ & ]( ){
+        benchmark::DoNotOptimize( tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_vector, NDI, NSHR, abaqus_standard ) );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_ExpandFullNTENSTensor )->Apply( NTENSSolverArguments );
+
+static void BM_ExpandFullNTENSTensorInto( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    const bool abaqus_standard = state.range( 2 );
+    std::vector< double > abaqus_vector = abaqusVector( NDI + NSHR );
+    std::vector< double > full_tensor( 9 );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::expandFullNTENSTensor( full_tensor, abaqus_vector, NDI, NSHR, abaqus_standard );
+        benchmark::DoNotOptimize( full_tensor.data( ) );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_ExpandFullNTENSTensorInto )->Apply( NTENSSolverArguments );
+
+static void BM_ExpandFullNTENSTensorArena( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    const bool abaqus_standard = state.range( 2 );
+    tardigradeAbaqusTools::BumpArena &arena = tardigradeAbaqusTools::threadArena( );
+    std::vector< double > values = abaqusVector( NDI + NSHR );
+    auto call = [ & ]( ){
+        {
+            std::vector< double, tardigradeAbaqusTools::ArenaAllocator< double > > abaqus_vector( values.begin( ), values.end( ),
+                                                                                                  arena );
+            benchmark::DoNotOptimize( tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_vector, NDI, NSHR, abaqus_standard ) );
+        }
+        arena.reset( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_ExpandFullNTENSTensorArena )->Apply( NTENSSolverArguments );
+
+static void BM_ExpandFullNTENSTensorArray( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    const bool abaqus_standard = state.range( 2 );
+    std::array< double, 6 > abaqus_vector = { 1, 2, 3, 4, 5, 6 };
+    auto call = [ & ]( ){
+        benchmark::DoNotOptimize( abaqus_vector );
+        benchmark::DoNotOptimize( tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_vector, NDI, NSHR, abaqus_standard ) );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_ExpandFullNTENSTensorArray )->Apply( NTENSSolverArguments );
+
+template< int NDI, int NSHR, tardigradeAbaqusTools::AbaqusSolver SOLVER >
+static void BM_ExpandFullNTENSTensorCompileTime( benchmark::State &state ){
+    std::array< double, 6 > abaqus_vector = { 1, 2, 3, 4, 5, 6 };
+    auto call = [ & ]( ){
+        benchmark::DoNotOptimize( abaqus_vector );
+        benchmark::DoNotOptimize( tardigradeAbaqusTools::expandFullNTENSTensor< NDI, NSHR, SOLVER >( abaqus_vector ) );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK_TEMPLATE( BM_ExpandFullNTENSTensorCompileTime, 3, 3, tardigradeAbaqusTools::AbaqusSolver::Standard );
+BENCHMARK_TEMPLATE( BM_ExpandFullNTENSTensorCompileTime, 3, 3, tardigradeAbaqusTools::AbaqusSolver::Explicit );
+BENCHMARK_TEMPLATE( BM_ExpandFullNTENSTensorCompileTime, 2, 1, tardigradeAbaqusTools::AbaqusSolver::Standard );
+
+static void BM_ContractFullNTENSTensor( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    const bool abaqus_standard = state.range( 2 );
+    std::vector< double > full_tensor = abaqusVector( 9 );
+    auto call = [ & ]( ){
+        benchmark::DoNotOptimize( tardigradeAbaqusTools::contractFullNTENSTensor( full_tensor, NDI, NSHR, abaqus_standard ) );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_ContractFullNTENSTensor )->Apply( NTENSSolverArguments );
+
+static void BM_ContractFullNTENSTensorArray( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    const bool abaqus_standard = state.range( 2 );
+    std::array< double, 9 > full_tensor = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    auto call = [ & ]( ){
+        benchmark::DoNotOptimize( full_tensor );
+        benchmark::DoNotOptimize( tardigradeAbaqusTools::contractFullNTENSTensor( full_tensor, NDI, NSHR, abaqus_standard ) );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_ContractFullNTENSTensorArray )->Apply( NTENSSolverArguments );
+
+static void BM_LazyFullNTENSTensorRoundTrip( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    const bool abaqus_standard = state.range( 2 );
+    std::vector< double > abaqus_vector = abaqusVector( NDI + NSHR );
+    std::vector< double > abaqus_result( NDI + NSHR );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::lazyContractFullNTENSTensor(
+            tardigradeAbaqusTools::lazyExpandFullNTENSTensor( abaqus_vector.data( ), NDI, NSHR, abaqus_standard ),
+            NDI, NSHR, abaqus_standard ).evaluate( abaqus_result );
+        benchmark::DoNotOptimize( abaqus_result.data( ) );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_LazyFullNTENSTensorRoundTrip )->Apply( NTENSSolverArguments );
+
+//======================================================================================== NTENS MATRIX CONVERSIONS ===
+static void BM_ContractAbaqusNTENSMatrix( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    std::vector< std::vector< double > > full_abaqus_matrix( 6, abaqusVector( 6 ) );
+    auto call = [ & ]( ){
+        benchmark::DoNotOptimize( tardigradeAbaqusTools::contractAbaqusNTENSMatrix( full_abaqus_matrix, NDI, NSHR ) );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_ContractAbaqusNTENSMatrix )->Apply( NTENSArguments );
+
+static void BM_ContractAbaqusNTENSMatrixInto( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    const int NTENS = NDI + NSHR;
+    std::vector< std::vector< double > > full_abaqus_matrix( 6, abaqusVector( 6 ) );
+    std::vector< double > DDSDDE( NTENS * NTENS );
+    tardigradeAbaqusTools::ColumnMajorView< double > ddsdde( DDSDDE.data( ), NTENS, NTENS );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::contractAbaqusNTENSMatrix( ddsdde, full_abaqus_matrix, NDI, NSHR );
+        benchmark::DoNotOptimize( DDSDDE.data( ) );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_ContractAbaqusNTENSMatrixInto )->Apply( NTENSArguments );
+
+static void BM_ContractFullNTENSMatrix( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    std::vector< std::vector< double > > full_matrix( 9, abaqusVector( 9 ) );
+    auto call = [ & ]( ){
+        benchmark::DoNotOptimize( tardigradeAbaqusTools::contractFullNTENSMatrix( full_matrix, NDI, NSHR ) );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_ContractFullNTENSMatrix )->Apply( NTENSArguments );
+
+static void BM_ContractFullNTENSMatrixDDSDDE( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    const bool symmetric = state.range( 2 );
+    std::vector< double > full_matrix = abaqusVector( 81 );
+    std::vector< double > DDSDDE( 36 );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::contractFullNTENSMatrix( DDSDDE.data( ), full_matrix.data( ), NDI, NSHR, true, symmetric );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_ContractFullNTENSMatrixDDSDDE )->Apply( NTENSSymmetricArguments );
+
+static void BM_ExpandFullNTENSMatrixDDSDDE( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    const bool symmetric = state.range( 2 );
+    std::vector< double > DDSDDE = abaqusVector( 36 );
+    std::vector< double > full_matrix( 81 );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::expandFullNTENSMatrix( full_matrix.data( ), DDSDDE.data( ), NDI, NSHR, true, symmetric );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_ExpandFullNTENSMatrixDDSDDE )->Apply( NTENSSymmetricArguments );
+
+//================================================================================================ BLOCK CONVERSIONS ===
+static void BM_ExpandFullNTENSTensorBlock( benchmark::State &state ){
+    const int nblock = state.range( 0 );
+    const bool abaqus_standard = state.range( 1 );
+    std::vector< double > abaqus_block = abaqusVector( 6 * nblock );
+    std::vector< double > full_block( 9 * nblock );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::expandFullNTENSTensorBlock( full_block.data( ), abaqus_block.data( ), nblock, 3, 3, abaqus_standard );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+    state.SetItemsProcessed( state.iterations( ) * nblock );
+}
+BENCHMARK( BM_ExpandFullNTENSTensorBlock )->Apply( BlockArguments );
+
+static void BM_ContractFullNTENSTensorBlock( benchmark::State &state ){
+    const int nblock = state.range( 0 );
+    const bool abaqus_standard = state.range( 1 );
+    std::vector< double > full_block = abaqusVector( 9 * nblock );
+    std::vector< double > abaqus_block( 6 * nblock );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::contractFullNTENSTensorBlock( abaqus_block.data( ), full_block.data( ), nblock, 3, 3, abaqus_standard );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+    state.SetItemsProcessed( state.iterations( ) * nblock );
+}
+BENCHMARK( BM_ContractFullNTENSTensorBlock )->Apply( BlockArguments );
+
+static void BM_ExpandFullNTENSTensorBlockScaleShear( benchmark::State &state ){
+    const int nblock = state.range( 0 );
+    const bool abaqus_standard = state.range( 1 );
+    std::vector< double > abaqus_block = abaqusVector( 6 * nblock );
+    std::vector< double > full_block( 9 * nblock );
+    auto call = [ & ]( ){
+        //The stress-type expansion followed by a second pass halving the engineering shear strains
+        tardigradeAbaqusTools::expandFullNTENSTensorBlock( full_block.data( ), abaqus_block.data( ), nblock, 3, 3, abaqus_standard );
+        for ( unsigned int component = 0; component < 9; component++ ){
+            if ( component % 4 != 0 ){
+                for ( int k = 0; k < nblock; k++ ){
+                    full_block[ component * nblock + k ] *= 0.5;
+                }
+            }
+        }
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+    state.SetItemsProcessed( state.iterations( ) * nblock );
+}
+BENCHMARK( BM_ExpandFullNTENSTensorBlockScaleShear )->Apply( BlockArguments );
+
+static void BM_ExpandFullNTENSStrainBlock( benchmark::State &state ){
+    const int nblock = state.range( 0 );
+    const bool abaqus_standard = state.range( 1 );
+    std::vector< double > abaqus_block = abaqusVector( 6 * nblock );
+    std::vector< double > full_block( 9 * nblock );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::expandFullNTENSStrainBlock( full_block.data( ), abaqus_block.data( ), nblock, 3, 3, true, abaqus_standard );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+    state.SetItemsProcessed( state.iterations( ) * nblock );
+}
+BENCHMARK( BM_ExpandFullNTENSStrainBlock )->Apply( BlockArguments );
+
+static void BM_ContractFullNTENSStrainBlock( benchmark::State &state ){
+    const int nblock = state.range( 0 );
+    const bool abaqus_standard = state.range( 1 );
+    std::vector< double > full_block = abaqusVector( 9 * nblock );
+    std::vector< double > abaqus_block( 6 * nblock );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::contractFullNTENSStrainBlock( abaqus_block.data( ), full_block.data( ), nblock, 3, 3, true, abaqus_standard );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+    state.SetItemsProcessed( state.iterations( ) * nblock );
+}
+BENCHMARK( BM_ContractFullNTENSStrainBlock )->Apply( BlockArguments );
+
+static void BM_ExpandFullNTENSTensorBatch( benchmark::State &state ){
+    const int npoints = state.range( 0 );
+    const bool abaqus_standard = state.range( 1 );
+    const tardigradeAbaqusTools::SIMDLevel simd_level = static_cast< tardigradeAbaqusTools::SIMDLevel >( state.range( 2 ) );
+    if ( simd_level > tardigradeAbaqusTools::detectSIMDLevel( ) ){
+        state.SkipWithError( "Instruction set not supported by this CPU" );
+        return;
+    }
+    std::vector< double > long_vectors = abaqusVector( 6 * npoints );
+    std::vector< double > full_tensors( 9 * npoints );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::expandFullNTENSTensorBatch( full_tensors.data( ), long_vectors.data( ), npoints, abaqus_standard, simd_level );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+    state.SetItemsProcessed( state.iterations( ) * npoints );
+}
+BENCHMARK( BM_ExpandFullNTENSTensorBatch )->ArgNames( { "npoints", "standard", "simd" } )
+                                          ->ArgsProduct( { { 1, 64, 4096 }, { 1, 0 }, { 0, 1, 2 } } );
+
+static void BM_ContractFullNTENSTensorBatch( benchmark::State &state ){
+    const int npoints = state.range( 0 );
+    const bool abaqus_standard = state.range( 1 );
+    const tardigradeAbaqusTools::SIMDLevel simd_level = static_cast< tardigradeAbaqusTools::SIMDLevel >( state.range( 2 ) );
+    if ( simd_level > tardigradeAbaqusTools::detectSIMDLevel( ) ){
+        state.SkipWithError( "Instruction set not supported by this CPU" );
+        return;
+    }
+    std::vector< double > full_tensors = abaqusVector( 9 * npoints );
+    std::vector< double > long_vectors( 6 * npoints );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::contractFullNTENSTensorBatch( long_vectors.data( ), full_tensors.data( ), npoints, abaqus_standard, simd_level );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+    state.SetItemsProcessed( state.iterations( ) * npoints );
+}
+BENCHMARK( BM_ContractFullNTENSTensorBatch )->ArgNames( { "npoints", "standard", "simd" } )
+                                            ->ArgsProduct( { { 1, 64, 4096 }, { 1, 0 }, { 0, 1, 2 } } );
+
+static void BM_ExpandFullNTENSTensorBatchMixed( benchmark::State &state ){
+    const int npoints = state.range( 0 );
+    const tardigradeAbaqusTools::SIMDLevel simd_level = static_cast< tardigradeAbaqusTools::SIMDLevel >( state.range( 1 ) );
+    if ( simd_level > tardigradeAbaqusTools::detectSIMDLevel( ) ){
+        state.SkipWithError( "Instruction set not supported by this CPU" );
+        return;
+    }
+    std::vector< double > double_vectors = abaqusVector( 6 * npoints );
+    std::vector< float > long_vectors( double_vectors.begin( ), double_vectors.end( ) );
+    std::vector< double > full_tensors( 9 * npoints );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::expandFullNTENSTensorBatch( full_tensors.data( ), long_vectors.data( ), npoints, true, simd_level );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+    state.SetItemsProcessed( state.iterations( ) * npoints );
+}
+BENCHMARK( BM_ExpandFullNTENSTensorBatchMixed )->ArgNames( { "npoints", "simd" } )
+                                               ->ArgsProduct( { { 64, 4096 }, { 0, 1 } } );
+
+static void BM_ConvertPrecision( benchmark::State &state ){
+    const int size = state.range( 0 );
+    const bool widen = state.range( 1 );
+    const tardigradeAbaqusTools::SIMDLevel simd_level = static_cast< tardigradeAbaqusTools::SIMDLevel >( state.range( 2 ) );
+    if ( simd_level > tardigradeAbaqusTools::detectSIMDLevel( ) ){
+        state.SkipWithError( "Instruction set not supported by this CPU" );
+        return;
+    }
+    std::vector< double > double_values = abaqusVector( size );
+    std::vector< float > float_values( double_values.begin( ), double_values.end( ) );
+    auto call = [ & ]( ){
+        widen ? tardigradeAbaqusTools::convertPrecision( double_values.data( ), float_values.data( ), size, simd_level ) :
+                tardigradeAbaqusTools::convertPrecision( float_values.data( ), double_values.data( ), size, simd_level );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+    state.SetItemsProcessed( state.iterations( ) * size );
+}
+BENCHMARK( BM_ConvertPrecision )->ArgNames( { "size", "widen", "simd" } )
+                                ->ArgsProduct( { { 100, 65536 }, { 1, 0 }, { 0, 1, 2 } } );
+
+static void BM_ElementPerPoint( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    const int NTENS = NDI + NSHR;
+    const int npoints = 27;
+    std::vector< double > STRESS = abaqusVector( NTENS * npoints );
+    std::vector< double > DDSDDE = abaqusVector( NTENS * NTENS * npoints );
+    std::vector< double > full_tensors( 9 * npoints );
+    std::vector< double > full_tangents( 81 * npoints );
+    auto call = [ & ]( ){
+        for ( int point = 0; point < npoints; point++ ){
+            tardigradeAbaqusTools::ColumnMajorView< const double > stress( STRESS.data( ) + NTENS * point, NTENS, 1 );
+            tardigradeAbaqusTools::expandFullNTENSTensor( full_tensors.data( ) + 9 * point, stress, NDI, NSHR );
+            tardigradeAbaqusTools::expandFullNTENSMatrix( full_tangents.data( ) + 81 * point, DDSDDE.data( ) + NTENS * NTENS * point,
+                                                          NDI, NSHR );
+        }
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+    state.SetItemsProcessed( state.iterations( ) * npoints );
+}
+BENCHMARK( BM_ElementPerPoint )->Apply( NTENSArguments );
+
+static void BM_ElementBatchConverter( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    const int NTENS = NDI + NSHR;
+    const int npoints = 27;
+    std::vector< double > STRESS = abaqusVector( NTENS * npoints );
+    std::vector< double > DDSDDE = abaqusVector( NTENS * NTENS * npoints );
+    std::vector< double > full_tensors( 9 * npoints );
+    std::vector< double > full_tangents( 81 * npoints );
+    tardigradeAbaqusTools::BatchConverter< double > converter( NDI, NSHR );
+    auto call = [ & ]( ){
+        converter.expandTensors( full_tensors.data( ), STRESS.data( ), npoints );
+        converter.expandTangents( full_tangents.data( ), DDSDDE.data( ), npoints );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+    state.SetItemsProcessed( state.iterations( ) * npoints );
+}
+BENCHMARK( BM_ElementBatchConverter )->Apply( NTENSArguments );
+
+//========================================================================================================= ROTATIONS ===
+static std::array< double, 9 > rotationIncrement( ){
+    //Column major rotation about the z axis by 0.1 radians
+    return { std::cos( 0.1 ), std::sin( 0.1 ), 0, -std::sin( 0.1 ), std::cos( 0.1 ), 0, 0, 0, 1 };
+}
+
+static void BM_RotateNTENSVectorFullTensor( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    std::vector< double > STRESS = abaqusVector( NDI + NSHR );
+    const std::array< double, 9 > DROT = rotationIncrement( );
+    auto call = [ & ]( ){
+        //The expand, R A R^T, contract detour through full 3x3 tensors
+        std::vector< double > full = tardigradeAbaqusTools::expandFullNTENSTensor( STRESS, NDI, NSHR );
+        std::vector< double > rotated( 9, 0. );
+        for ( unsigned int i = 0; i < 3; i++ ){
+            for ( unsigned int j = 0; j < 3; j++ ){
+                for ( unsigned int k = 0; k < 3; k++ ){
+                    for ( unsigned int l = 0; l < 3; l++ ){
+                        rotated[ 3 * i + j ] += DROT[ i + 3 * k ] * full[ 3 * k + l ] * DROT[ j + 3 * l ];
+                    }
+                }
+            }
+        }
+        STRESS = tardigradeAbaqusTools::contractFullNTENSTensor( rotated, NDI, NSHR );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_RotateNTENSVectorFullTensor )->Apply( NTENSArguments );
+
+static void BM_RotateNTENSVector( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    std::vector< double > STRESS = abaqusVector( NDI + NSHR );
+    const std::array< double, 9 > DROT = rotationIncrement( );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::rotateNTENSVector( STRESS.data( ), DROT.data( ), NDI, NSHR );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_RotateNTENSVector )->Apply( NTENSArguments );
+
+static void BM_RotateNTENSBlock( benchmark::State &state ){
+    const int nblock = state.range( 0 );
+    const bool abaqus_standard = state.range( 1 );
+    std::vector< double > abaqus_block = abaqusVector( 6 * nblock );
+    const std::array< double, 9 > DROT = rotationIncrement( );
+    std::vector< double > rotation_block( 9 * nblock );
+    for ( unsigned int index = 0; index < 9; index++ ){
+        std::fill( rotation_block.begin( ) + index * nblock, rotation_block.begin( ) + ( index + 1 ) * nblock, DROT[ index ] );
+    }
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::rotateNTENSBlock( abaqus_block.data( ), rotation_block.data( ), nblock, 3, 3, false, abaqus_standard );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+    state.SetItemsProcessed( state.iterations( ) * nblock );
+}
+BENCHMARK( BM_RotateNTENSBlock )->Apply( BlockArguments );
+
+//===================================================================================================== TENSOR ALGEBRA ===
+static void BM_VonMisesWorkFullTensor( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    const std::vector< double > STRESS = abaqusVector( NDI + NSHR );
+    const std::vector< double > DSTRAN = abaqusVector( NDI + NSHR );
+    auto call = [ & ]( ){
+        //The von Mises stress and work increment through the expanded full tensors
+        const std::vector< double > stress = tardigradeAbaqusTools::expandFullNTENSTensor( STRESS, NDI, NSHR );
+        std::vector< double > strain = tardigradeAbaqusTools::expandFullNTENSTensor( DSTRAN, NDI, NSHR );
+        const double pressure = ( stress[ 0 ] + stress[ 4 ] + stress[ 8 ] ) / 3;
+        double ss = 0;
+        double work = 0;
+        for ( unsigned int i = 0; i < 3; i++ ){
+            for ( unsigned int j = 0; j < 3; j++ ){
+                const double s = stress[ 3 * i + j ] - ( i == j ? pressure : 0. );
+                ss += s * s;
+                work += stress[ 3 * i + j ] * strain[ 3 * i + j ] * ( i == j ? 1. : 0.5 );
+            }
+        }
+        benchmark::DoNotOptimize( std::sqrt( 1.5 * ss ) );
+        benchmark::DoNotOptimize( work );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_VonMisesWorkFullTensor )->Apply( NTENSArguments );
+
+static void BM_NTENSVonMisesWork( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    const std::vector< double > STRESS = abaqusVector( NDI + NSHR );
+    const std::vector< double > DSTRAN = abaqusVector( NDI + NSHR );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::dispatchNTENS( NDI, NSHR, [ & ]( auto ndi, auto nshr ){
+            benchmark::DoNotOptimize( tardigradeAbaqusTools::NTENSVonMises< ndi, nshr >( STRESS.data( ) ) );
+            benchmark::DoNotOptimize( tardigradeAbaqusTools::NTENSWork< ndi, nshr >( STRESS.data( ), DSTRAN.data( ) ) );
+        } );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_NTENSVonMisesWork )->Apply( NTENSArguments );
+
+static void BM_NTENSTangentProduct( benchmark::State &state ){
+    const int NDI = state.range( 0 );
+    const int NSHR = state.range( 1 );
+    const std::vector< double > DDSDDE = abaqusVector( ( NDI + NSHR ) * ( NDI + NSHR ) );
+    const std::vector< double > DSTRAN = abaqusVector( NDI + NSHR );
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::dispatchNTENS( NDI, NSHR, [ & ]( auto ndi, auto nshr ){
+            auto DSTRESS = tardigradeAbaqusTools::NTENSTangentProduct< ndi, nshr >( DDSDDE.data( ), DSTRAN.data( ) );
+            benchmark::DoNotOptimize( DSTRESS );
+        } );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_NTENSTangentProduct )->Apply( NTENSArguments );
+
+//=============================================================================================== STRING CONVERSIONS ===
+static void BM_WorkspacePoint( benchmark::State &state ){
+    const int NSTATV = state.range( 0 );
+    std::vector< double > STATEV = abaqusVector( NSTATV );
+    tardigradeAbaqusTools::Workspace< double > &workspace = tardigradeAbaqusTools::threadWorkspace( );
+    int KINC = 0;
+    auto call = [ & ]( ){
+        tardigradeAbaqusTools::PointWorkspace< double > &point = workspace.point( 100, 4, 1, ++KINC );
+        benchmark::DoNotOptimize( point.stateVariables( STATEV.data( ), NSTATV ).data( ) );
+    };
+    call( );
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_WorkspacePoint )->ArgName( "NSTATV" )->Arg( 10 )->Arg( 100 );
+
+struct PlasticStrain{ static constexpr int components = 6; };
+struct EquivalentPlasticStrain{ static constexpr int components = 1; };
+struct BackStress{ static constexpr int components = 6; };
+using StateLayout = tardigradeAbaqusTools::StateVariableLayout< PlasticStrain, EquivalentPlasticStrain, BackStress >;
+
+static void BM_StateVariablesCopyUnchanged( benchmark::State &state ){
+    const int nblock = state.range( 0 );
+    std::vector< double > stateOld = abaqusVector( nblock * StateLayout::size );
+    std::vector< double > stateNew( nblock * StateLayout::size );
+    auto call = [ & ]( ){
+        StateLayout::copyUnchanged< EquivalentPlasticStrain >( stateNew.data( ), stateOld.data( ), nblock );
+        tardigradeAbaqusTools::StateVariables< StateLayout > new_state( stateNew.data( ), nblock );
+        for ( int k = 0; k < nblock; k++ ){
+            new_state.get< EquivalentPlasticStrain >( k ) += 1;
+        }
+        benchmark::DoNotOptimize( stateNew.data( ) );
+        benchmark::ClobberMemory( );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_StateVariablesCopyUnchanged )->ArgName( "nblock" )->RangeMultiplier( 8 )->Range( 1, 4096 );
+
+static void BM_FtoCString( benchmark::State &state ){
+    const char CMNAME[ 81 ] = "MATERIAL                                                                        ";
+    auto call = [ & ]( ){
+        char *name = tardigradeAbaqusTools::FtoCString( 80, CMNAME );
+        benchmark::DoNotOptimize( name );
+        delete[] name;
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_FtoCString );
+
+static void BM_FtoStringView( benchmark::State &state ){
+    const char CMNAME[ 81 ] = "MATERIAL                                                                        ";
+    auto call = [ & ]( ){
+        benchmark::DoNotOptimize( tardigradeAbaqusTools::FtoStringView( 80, CMNAME ) );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_FtoStringView );
+
+static void BM_InternMaterialName( benchmark::State &state ){
+    const char CMNAME[ 81 ] = "MATERIAL                                                                        ";
+    tardigradeAbaqusTools::internMaterialName( 80, CMNAME );
+    auto call = [ & ]( ){
+        benchmark::DoNotOptimize( tardigradeAbaqusTools::internMaterialName( 80, CMNAME ) );
+    };
+    countAllocations( state, call );
+    for ( auto _ : state ){
+        call( );
+    }
+}
+BENCHMARK( BM_InternMaterialName );
+
+BENCHMARK_MAIN( );
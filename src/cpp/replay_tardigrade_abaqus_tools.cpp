@@ -0,0 +1,144 @@
+/**
+  ******************************************************************************
+  * \file replay_tardigrade_abaqus_tools.cpp
+  ******************************************************************************
+  * Replay a UMAT or VUMAT trace recorded with tardigradeAbaqusTools::recordUMAT
+  * or tardigradeAbaqusTools::recordVUMAT through the conversions of the abaqus
+  * tools library without Abaqus.
+  *
+  * Usage: replay_tardigrade_abaqus_tools TRACE [REPETITIONS]
+  ******************************************************************************
+  */
+
+#include<chrono>
+#include<iostream>
+#include<string>
+#include<vector>
+
+#include<tardigrade_abaqus_tools_io.h>
+
+namespace{
+
+    void convertUMAT( tardigradeAbaqusTools::UMATReplayCall &call, std::array< double, 9 > &stress,
+                      std::array< double, 9 > &strain, std::array< double, 9 > &strain_increment,
+                      std::array< double, 81 > &tangent ){
+        /*!
+         * The conversions of a typical UMAT: expand the stress, strain, strain increment, and tangent into full tensors
+         * and contract the stress and tangent back into the Abaqus arrays.
+         *
+         * \param &call: The replayed UMAT call
+         * \param &stress: The full stress buffer
+         * \param &strain: The full strain buffer
+         * \param &strain_increment: The full strain increment buffer
+         * \param &tangent: The full tangent buffer
+         */
+        const int NTENS = call.NDI + call.NSHR;
+        tardigradeAbaqusTools::ColumnMajorView< double > STRESS( call.STRESS, NTENS, 1 );
+        tardigradeAbaqusTools::ColumnMajorView< const double > STRAN( call.STRAN, NTENS, 1 );
+        tardigradeAbaqusTools::ColumnMajorView< const double > DSTRAN( call.DSTRAN, NTENS, 1 );
+
+        tardigradeAbaqusTools::expandFullNTENSTensor( stress, STRESS, call.NDI, call.NSHR );
+        tardigradeAbaqusTools::expandFullNTENSTensor( strain, STRAN, call.NDI, call.NSHR );
+        tardigradeAbaqusTools::expandFullNTENSTensor( strain_increment, DSTRAN, call.NDI, call.NSHR );
+        tardigradeAbaqusTools::expandFullNTENSMatrix( tangent.data( ), call.DDSDDE, call.NDI, call.NSHR );
+
+        tardigradeAbaqusTools::contractFullNTENSTensor( STRESS, stress, call.NDI, call.NSHR );
+        tardigradeAbaqusTools::contractFullNTENSMatrix( call.DDSDDE, tangent.data( ), call.NDI, call.NSHR );
+    }
+
+    void convertVUMAT( tardigradeAbaqusTools::VUMATReplayCall &call, std::vector< double > &stress,
+                       std::vector< double > &strain_increment ){
+        /*!
+         * The conversions of a typical VUMAT: expand the old stress and the strain increment blocks into full tensor
+         * blocks and contract the stress block into the new stress.
+         *
+         * \param &call: The replayed VUMAT call
+         * \param &stress: The full stress block buffer
+         * \param &strain_increment: The full strain increment block buffer
+         */
+        stress.resize( 9 * std::size_t( call.nblock ) );
+        strain_increment.resize( 9 * std::size_t( call.nblock ) );
+
+        tardigradeAbaqusTools::expandFullNTENSTensorBlock( stress.data( ), call.stressOld, call.nblock, call.ndir, call.nshr,
+                                                           false );
+        tardigradeAbaqusTools::expandFullNTENSTensorBlock( strain_increment.data( ), call.strainInc, call.nblock, call.ndir,
+                                                           call.nshr, false );
+
+        tardigradeAbaqusTools::contractFullNTENSTensorBlock( call.stressNew, stress.data( ), call.nblock, call.ndir,
+                                                             call.nshr, false );
+    }
+
+    template< class Function >
+    void replayTrace( const tardigradeAbaqusTools::UMATTrace &trace, Function &&model ){
+        tardigradeAbaqusTools::replayUMATTrace( trace, model );
+    }
+
+    template< class Function >
+    void replayTrace( const tardigradeAbaqusTools::VUMATTrace &trace, Function &&model ){
+        tardigradeAbaqusTools::replayVUMATTrace( trace, model );
+    }
+
+    template< class Trace, class Convert >
+    void replay( const Trace &trace, const int &repetitions, Convert &&convert ){
+        /*!
+         * Replay a trace and report the timing
+         *
+         * \param &trace: The recorded calls
+         * \param &repetitions: The number of replays of the whole trace
+         * \param &&convert: Called as ``convert( call )`` per replayed call. Returns a value added to the checksum.
+         */
+        double checksum = 0;
+
+        const auto start = std::chrono::steady_clock::now( );
+        for ( int repetition = 0; repetition < repetitions; repetition++ ){
+            replayTrace( trace, [ & ]( auto &call ){
+                checksum += convert( call );
+            } );
+        }
+        const std::chrono::duration< double > elapsed = std::chrono::steady_clock::now( ) - start;
+
+        const double calls = static_cast< double >( trace.size( ) ) * repetitions;
+        std::cout << "records: " << trace.size( ) << "\n"
+                  << "repetitions: " << repetitions << "\n"
+                  << "seconds: " << elapsed.count( ) << "\n"
+                  << "ns/call: " << ( calls > 0 ? 1e9 * elapsed.count( ) / calls : 0 ) << "\n"
+                  << "checksum: " << checksum << "\n";
+    }
+
+}
+
+int main( int argc, char **argv ){
+
+    if ( argc < 2 || argc > 3 ){
+        std::cerr << "Usage: " << argv[ 0 ] << " TRACE [REPETITIONS]\n";
+        return 2;
+    }
+
+    try{
+        const int repetitions = argc == 3 ? std::stoi( argv[ 2 ] ) : 1;
+
+        if ( tardigradeAbaqusTools::isVUMATTrace( argv[ 1 ] ) ){
+            const tardigradeAbaqusTools::VUMATTrace trace( argv[ 1 ] );
+            std::vector< double > stress, strain_increment;
+            replay( trace, repetitions, [ & ]( tardigradeAbaqusTools::VUMATReplayCall &call ){
+                convertVUMAT( call, stress, strain_increment );
+                return call.nblock > 0 ? call.stressNew[ 0 ] : 0.;
+            } );
+        }
+        else{
+            const tardigradeAbaqusTools::UMATTrace trace( argv[ 1 ] );
+            std::array< double, 9 > stress, strain, strain_increment;
+            std::array< double, 81 > tangent;
+            replay( trace, repetitions, [ & ]( tardigradeAbaqusTools::UMATReplayCall &call ){
+                convertUMAT( call, stress, strain, strain_increment, tangent );
+                return call.STRESS[ 0 ] + call.DDSDDE[ 0 ];
+            } );
+        }
+    }
+    catch ( const std::exception &error ){
+        std::cerr << error.what( ) << "\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -12,547 +12,5813 @@
 
 #include<iostream>
 #include<vector>
+#include<algorithm>
+#include<array>
+#include<memory>
+#include<cstddef>
+#include<cstdint>
+#include<functional>
+#include<new>
+#include<string>
+#include<string_view>
+#include<unordered_map>
+#include<unordered_set>
+#include<type_traits>
+#include<cmath>
+#include<stdexcept>
+#include<atomic>
+#include<mutex>
+#include<chrono>
+#include<fstream>
+#include<cstdlib>
 #include<string.h>
 #include<stdio.h>
 
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+    #define TARDIGRADE_ABAQUS_TOOLS_X86_SIMD
+    #include<immintrin.h>
+#endif
+
+//! Validate NDI, NSHR, and the container sizes in the converters. Defaults to 1 in debug builds and 0 when ``NDEBUG`` is
+//! defined. Define as 1 or 0, e.g. with the ``TARDIGRADE_ABAQUS_TOOLS_CHECK_SIZES`` CMake option, to override.
+#ifndef TARDIGRADE_ABAQUS_TOOLS_CHECK_SIZES
+    #ifdef NDEBUG
+        #define TARDIGRADE_ABAQUS_TOOLS_CHECK_SIZES 0
+    #else
+        #define TARDIGRADE_ABAQUS_TOOLS_CHECK_SIZES 1
+    #endif
+#endif
+
+//! Count the calls, bytes moved, and cycles of each converter. Defaults to 0, which removes the instrumentation. Define
+//! as 1, e.g. with the ``TARDIGRADE_ABAQUS_TOOLS_INSTRUMENTATION`` CMake option, to enable.
+#ifndef TARDIGRADE_ABAQUS_TOOLS_INSTRUMENTATION
+    #define TARDIGRADE_ABAQUS_TOOLS_INSTRUMENTATION 0
+#endif
+
+//! Time one of every period instrumented calls per thread. Reading the cycle counter dominates the instrumentation cost,
+//! particularly in virtual machines, so larger periods trade timing resolution for lower overhead.
+#ifndef TARDIGRADE_ABAQUS_TOOLS_INSTRUMENTATION_SAMPLE_PERIOD
+    #define TARDIGRADE_ABAQUS_TOOLS_INSTRUMENTATION_SAMPLE_PERIOD 1
+#endif
+
+#if TARDIGRADE_ABAQUS_TOOLS_INSTRUMENTATION
+    #define TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( converter, bytes ) \
+        tardigradeAbaqusTools::ScopedInstrumentation tardigrade_abaqus_tools_instrumentation( \
+            tardigradeAbaqusTools::Converter::converter, bytes )
+#else
+    #define TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( converter, bytes )
+#endif
+
 namespace tardigradeAbaqusTools{
 
-    inline char *FtoCString( int stringLength, const char* fString ){
+    //! Extent value used by the array views when the dimension is only known at runtime
+    constexpr int dynamicExtent = -1;
+
+    //! Edge length of the square tiles used by the blocked row/column major transpose
+    constexpr int transposeBlockSize = 32;
+
+    //! Number of array entries above which the row/column major conversions use the blocked transpose
+    constexpr int blockedTransposeThreshold = 4096;
+
+    //! Expanded Abaqus/Standard stress-type vector index of each row-major full tensor component
+    constexpr std::array< unsigned int, 9 > standardExpandOrder = { 0, 3, 4,
+                                                                    3, 1, 5,
+                                                                    4, 5, 2 };
+
+    //! Expanded Abaqus/Explicit stress-type vector index of each row-major full tensor component
+    constexpr std::array< unsigned int, 9 > explicitExpandOrder = { 0, 3, 5,
+                                                                    3, 1, 4,
+                                                                    5, 4, 2 };
+
+    //! Row-major full tensor index of each expanded Abaqus/Standard stress-type vector component
+    constexpr std::array< unsigned int, 6 > standardContractOrder = { 0, 4, 8, 1, 2, 5 };
+
+    //! Row-major full tensor index of each expanded Abaqus/Explicit stress-type vector component
+    constexpr std::array< unsigned int, 6 > explicitContractOrder = { 0, 4, 8, 1, 5, 2 };
+
+    //! Abaqus solvers, which differ in the packing order of the shear components
+    enum class AbaqusSolver : unsigned int{
+        Standard, //!< Abaqus/Standard, e.g. the UMAT. Shear components 12, 13, 23
+        Explicit  //!< Abaqus/Explicit, e.g. the VUMAT. Shear components 12, 23, 13
+    };
+
+    //! Expanded stress-type vector index of each row-major full tensor component indexed by ``AbaqusSolver``
+    constexpr std::array< std::array< unsigned int, 9 >, 2 > expandOrders = { standardExpandOrder, explicitExpandOrder };
+
+    //! Row-major full tensor index of each expanded stress-type vector component indexed by ``AbaqusSolver``
+    constexpr std::array< std::array< unsigned int, 6 >, 2 > contractOrders = { standardContractOrder, explicitContractOrder };
+
+    constexpr AbaqusSolver abaqusSolver( const bool abaqus_standard ){
         /*!
-         * Converts a Fortran string to C-string. Trims trailing white space during processing.
-         *
-         * Code excerpt from a c++ Abaqus FILM subroutine in the Abaqus Knowledge Base:
-         * https://kb.dsxclient.3ds.com/mashup-ui/page/resultqa?from=search%3fq%3dwriting%2bsubroutine%2bc%252B%252B&id=QA00000008005e&q=writing%20subroutine%20c%2B%2B
-         *
-         * TODO: update coding style to match project.
+         * Map the ``abaqus_standard`` flag of the runtime overloads to the solver type
          *
-         * \param stringLength: The length of the Fortran string.
-         * \param *fString: The pointer to the start of the Fortran string.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         * \returns The solver type
          */
-        int stringLen = stringLength;
-        for ( int k1 = stringLength - 1; k1 >= 0; k1-- )
-    	{
-    	    if ( fString[ k1 ] != ' ' ) break;
-    	    stringLen = k1;
-    	}
-        char* cString  = new char [ stringLen + 1 ];
-        memcpy ( cString, fString, stringLen );
-        cString[ stringLen ] = '\0';
-        return cString;
+        return abaqus_standard ? AbaqusSolver::Standard : AbaqusSolver::Explicit;
     }
 
-    template< typename T >
-    inline std::vector< std::vector< T > > columnToRowMajor( const T *column_major,  const int &height, const int &width ){
+    constexpr const std::array< unsigned int, 9 > &expandOrder( const AbaqusSolver solver ){
         /*!
-         * Convert column major two dimensional arrays to row major.
-         *
-         * Specifically, convert pointers to Fortran column major arrays to c++ row major vector of vectors.
+         * The expanded stress-type vector index of each row-major full tensor component
          *
-         * \param *column_major: The pointer to the start of a column major array
-         * \param &height: The height of the array, e.g. number of rows
-         * \param &width: The width of the array, e.g. number of columns
-         * \return row_major: A c++ row major vector of vectors
+         * \param solver: The Abaqus solver type
          */
-        std::vector< std::vector< T > > row_major;
-        int column_major_index;
-        for ( int row = 0; row < height; row++ ){
-            std::vector< T > row_vector;
-            for ( int col = 0; col < width; col++ ){
-                column_major_index = col*height + row;
-                row_vector.push_back( *( column_major + column_major_index ) );
-            }
-            row_major.push_back( row_vector );
-        }
-        return row_major;
+        return expandOrders[ static_cast< std::size_t >( solver ) ];
     }
 
-    template< typename T >
-    inline void rowToColumnMajor( T *column_major, const std::vector< std::vector< T > > &row_major_array,
-                                  const int &height, const int &width ){
+    constexpr const std::array< unsigned int, 6 > &contractOrder( const AbaqusSolver solver ){
         /*!
-         * Convert row major two dimensional arrays to column major
+         * The row-major full tensor index of each expanded stress-type vector component
          *
-         * Specifically, c++ row major vector of vectors or arrays to Fortran column major arrays using the column major
-         * pointer.
+         * \param solver: The Abaqus solver type
+         */
+        return contractOrders[ static_cast< std::size_t >( solver ) ];
+    }
+
+    constexpr bool isPackingRoundTrip( const AbaqusSolver solver ){
+        /*!
+         * Check that contracting an expanded full tensor recovers the expanded vector and that expanding a contracted
+         * full tensor recovers each component or its transpose.
          *
-         * \param *column_major: The pointer to the start of a column major array
-         * \param &row_major_array: A c++ two dimensional, row major vector of vectors
-         * \param &height: The height of the array, e.g. number of rows
-         * \param &width: The width of the array, e.g. number of columns
+         * \param solver: The Abaqus solver type
          */
-        const int rows = row_major_array.size();
-        const int columns = row_major_array[0].size();
-        if (rows != height || columns != width){
-            throw std::length_error("Column major size must match row major size");
+        const std::array< unsigned int, 9 > &expand_order = expandOrder( solver );
+        const std::array< unsigned int, 6 > &contract_order = contractOrder( solver );
+        for ( unsigned int index = 0; index < 6; index++ ){
+            if ( expand_order[ contract_order[ index ] ] != index ){
+                return false;
+            }
         }
-        int column_major_index;
-        for ( int row = 0; row < height; row++ ){
-            for ( int col = 0; col < width; col++ ){
-                column_major_index = col*height + row;
-                column_major[column_major_index] = row_major_array[row][col];
+        for ( unsigned int row = 0; row < 3; row++ ){
+            for ( unsigned int col = 0; col < 3; col++ ){
+                const unsigned int component = contract_order[ expand_order[ 3 * row + col ] ];
+                if ( component != 3 * row + col && component != 3 * col + row ){
+                    return false;
+                }
             }
         }
-
-        return;
+        return true;
     }
 
-    template< typename T >
-    inline void rowToColumnMajor( T *column_major, const std::vector< T > &row_major, const int &height, const int &width ){
+    static_assert( isPackingRoundTrip( AbaqusSolver::Standard ), "The Abaqus/Standard packing orders must be inverses" );
+    static_assert( isPackingRoundTrip( AbaqusSolver::Explicit ), "The Abaqus/Explicit packing orders must be inverses" );
+
+    //! True when the converters validate NDI, NSHR, and the container sizes
+    constexpr bool checkSizes = TARDIGRADE_ABAQUS_TOOLS_CHECK_SIZES;
+
+    constexpr void checkNTENS( const int &NDI, const int &NSHR ){
         /*!
-         * Convert row major two dimensional arrays stored as vector to column major array
-         *
-         * Specifically, c++ row major vector to Fortran column major arrays using the column major pointer.
+         * Throw a ``std::invalid_argument`` unless 1 <= NDI <= 3 and 0 <= NSHR <= 3. The check is removed when
+         * ``TARDIGRADE_ABAQUS_TOOLS_CHECK_SIZES`` is 0.
          *
-         * \param *column_major: The pointer to the start of a column major array
-         * \param &row_major_array: A c++ two dimensional array stored as row major vector
-         * \param &height: The height of the array, e.g. number of rows. The c++ row count (1) for 1D arrays.
-         * \param &width: The width of the array, e.g. number of columns. The c++ column count (size) for 1D arrays.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
          */
-        const int length = row_major.size();
-        if (length != height*width){
-            throw std::length_error("Column major size must match row major size");
-        }
-        int row_major_index;
-        int column_major_index;
-        for ( int row = 0; row < height; row++ ){
-            for ( int col = 0; col < width; col++ ){
-                row_major_index = row*width + col;
-                column_major_index = col*height + row;
-                column_major[column_major_index] = row_major[row_major_index];
+        if constexpr ( checkSizes ){
+            if ( NDI < 1 || NDI > 3 || NSHR < 0 || NSHR > 3 ){
+                throw std::invalid_argument( "NDI must be in the range [1, 3] and NSHR must be in the range [0, 3]" );
             }
         }
     }
 
-    template< typename T >
-    inline std::vector< T > expandAbaqusNTENSVector( const std::vector< T > &abaqus_vector,
-                                                     const int &NDI, const int &NSHR ){
+    constexpr int expandedIndex( const int &index, const int &NDI ){
         /*!
-         * Expand stress and strain type components to full Abaqus vectors.
-         *
-         * See the Abaqus documentation > Introduction & Spatial Modeling > Conventions chapter > Convention used for stress
-         * and strain components.
-         *
-         * The stress vector components for Abaqus/Standard (UMAT) are
-         *
-         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{13}, \tau_{23} \right ) \f$
-         *
-         * and the strain vector components match as
-         *
-         * \f$ \left ( \epsilon_{11}, \epsilon_{22}, \epsilon_{33}, \gamma_{12}, \gamma_{13}, \gamma_{23} \right ) \f$
-         *
-         * The stress vector components for Abaqus/Explicit (VUMAT) are
-         *
-         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{23}, \tau_{13} \right ) \f$
-         *
-         * and the strain vector components match as
-         *
-         * \f$ \left ( \epsilon_{11}, \epsilon_{22}, \epsilon_{33}, \gamma_{12}, \gamma_{23}, \gamma_{13} \right ) \f$
-         *
-         * where components that are zero-valued by definition, e.g. plane stress, are omitted. The shear strain is the
-         * engineering shear strain where
+         * Map a contracted Abaqus stress-type vector index to the expanded (length 6) vector index
          *
-         * \f$ \gamma_{ij} = \epsilon_{ij} + \epsilon_{ji} \f$
-         *
-         * for both Abaqus/Standard and Abaqus/Explicit.
+         * \param &index: The contracted vector index in the range [0, NDI + NSHR)
+         * \param &NDI: The number of direct components.
+         * \returns The expanded vector index
+         */
+        return index < NDI ? index : 3 + index - NDI;
+    }
+
+    constexpr int contractedIndex( const int &long_index, const int &NDI, const int &NSHR ){
+        /*!
+         * Map an expanded (length 6) Abaqus stress-type vector index to the contracted vector index
          *
-         * \param &abaqus_vector: an abaqus stress-type vector with no by-definition-zero components. Length NDI + NSHR.
+         * \param &long_index: The expanded vector index in the range [0, 6)
          * \param &NDI: The number of direct components.
          * \param &NSHR: The number of shear components.
-         * \returns vector_expansion: c++ type vector of length 6.
+         * \returns The contracted vector index or -1 for by-definition-zero components
          */
+        return long_index < 3 ? ( long_index < NDI ? long_index : -1 ) : ( long_index - 3 < NSHR ? NDI + long_index - 3 : -1 );
+    }
 
-        //Initialize expanded vector to the appropriate dimensions with zero values
-        std::vector< T > vector_expansion( 6, 0 );
+    constexpr std::array< int, 9 > fullTensorNTENSIndex( const int &NDI, const int &NSHR, const bool abaqus_standard = true ){
+        /*!
+         * Compose the expansion of the contracted Abaqus stress-type vector and the expansion of the full tensor into a
+         * single map from each row-major full tensor component to the contracted vector index
+         *
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns The contracted vector index of each full tensor component or -1 for by-definition-zero components
+         */
+        checkNTENS( NDI, NSHR );
 
-        //Unpack direct components of Abaqus/Standard stress-type vector
-        for ( int index = 0; index < NDI; index++ ){
-            vector_expansion[ index ] = abaqus_vector[ index ];
-        }
+        const std::array< unsigned int, 9 > &expand_order = expandOrder( abaqusSolver( abaqus_standard ) );
 
-        //Unpack shear components of Abaqus/Standard stress-type vector
-        for ( int index = 0; index < NSHR; index++ ){
-            vector_expansion[ 3 + index ] = abaqus_vector[ NDI + index ];
+        std::array< int, 9 > index_map = { };
+        for ( unsigned int index = 0; index < 9; index++ ){
+            index_map[ index ] = contractedIndex( expand_order[ index ], NDI, NSHR );
         }
 
-        return vector_expansion;
+        return index_map;
     }
 
-    template< typename T >
-    inline std::vector< T > contractAbaqusNTENSVector( const std::vector< T > &full_abaqus_vector,
-                                                       const int &NDI, const int &NSHR ){
+    constexpr std::array< unsigned int, 6 > NTENSFullTensorIndex( const int &NDI, const int &NSHR, const bool abaqus_standard = true ){
         /*!
-         * Contract stress and strain type components from full Abaqus vectors.
-         *
-         * See the Abaqus documentation > Introduction & Spatial Modeling > Conventions chapter > Convention used for stress
-         * and strain components.
-         *
-         * The stress vector components for Abaqus/Standard (UMAT) are
-         *
-         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{13}, \tau_{23} \right ) \f$
-         *
-         * and the strain vector components match as
-         *
-         * \f$ \left ( \epsilon_{11}, \epsilon_{22}, \epsilon_{33}, \gamma_{12}, \gamma_{13}, \gamma_{23} \right ) \f$
-         *
-         * The stress vector components for Abaqus/Explicit (VUMAT) are
-         *
-         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{23}, \tau_{13} \right ) \f$
-         *
-         * and the strain vector components match as
-         *
-         * \f$ \left ( \epsilon_{11}, \epsilon_{22}, \epsilon_{33}, \gamma_{12}, \gamma_{23}, \gamma_{13} \right ) \f$
-         *
-         * where components that are zero-valued by definition, e.g. plane stress, are omitted. The shear strain is the
-         * engineering shear strain where
+         * Compose the contraction of the full tensor and the contraction of the full Abaqus stress-type vector into a
+         * single map from each contracted vector component to the row-major full tensor index
          *
-         * \f$ \gamma_{ij} = \epsilon_{ij} + \epsilon_{ji} \f$
-         *
-         * for both Abaqus/Standard and Abaqus/Explicit.
-         *
-         * \param &full_abaqus_vector: a previously expanded abaqus stress-type vector. Length 6.
          * \param &NDI: The number of direct components.
          * \param &NSHR: The number of shear components.
-         * \returns vector_contraction: c++ type vector of length NDI + NSHR.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns The full tensor index of each contracted vector component in the leading NDI + NSHR entries. The
+         *     trailing entries are zero.
          */
+        checkNTENS( NDI, NSHR );
 
-        //Initialize contracted vector to the appropriate dimensions
-        std::vector< T > vector_contraction( NDI + NSHR );
+        const std::array< unsigned int, 6 > &contract_order = contractOrder( abaqusSolver( abaqus_standard ) );
 
-        //Pack non-zero direct components of Abaqus/Standard stress-type vector
-        for ( int index = 0; index < NDI; index++ ){
-            vector_contraction[ index ] = full_abaqus_vector[ index ];
+        std::array< unsigned int, 6 > index_map = { };
+        for ( int index = 0; index < NDI + NSHR; index++ ){
+            index_map[ index ] = contract_order[ expandedIndex( index, NDI ) ];
         }
 
-        //Pack non-zero shear components of Abaqus/Standard stress-type vector
-        for ( int index = 0; index < NSHR; index++ ){
-            vector_contraction[ NDI + index ] = full_abaqus_vector[ 3 + index ];
-        }
+        return index_map;
+    }
 
-        return vector_contraction;
+    //! Compile time map from each row-major full tensor component to the contracted Abaqus stress-type vector index
+    template< int NDI, int NSHR, bool ABAQUS_STANDARD >
+    constexpr std::array< int, 9 > fullTensorNTENSMap = fullTensorNTENSIndex( NDI, NSHR, ABAQUS_STANDARD );
+
+    //! Compile time map from each contracted Abaqus stress-type vector component to the row-major full tensor index
+    template< int NDI, int NSHR, bool ABAQUS_STANDARD >
+    constexpr std::array< unsigned int, 6 > NTENSFullTensorMap = NTENSFullTensorIndex( NDI, NSHR, ABAQUS_STANDARD );
+
+    constexpr bool isNTENSRoundTrip( ){
+        /*!
+         * Check that expanding a contracted vector into a full tensor and contracting it again is the identity for
+         * every valid combination of NDI, NSHR, and solver type.
+         */
+        for ( int NDI = 1; NDI <= 3; NDI++ ){
+            for ( int NSHR = 0; NSHR <= 3; NSHR++ ){
+                for ( bool abaqus_standard : { true, false } ){
+                    const std::array< int, 9 > expand_map = fullTensorNTENSIndex( NDI, NSHR, abaqus_standard );
+                    const std::array< unsigned int, 6 > contract_map = NTENSFullTensorIndex( NDI, NSHR, abaqus_standard );
+                    for ( int index = 0; index < NDI + NSHR; index++ ){
+                        if ( expand_map[ contract_map[ index ] ] != index ){
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+        return true;
     }
 
-    template< typename T >
-    inline std::vector< std::vector < T > > contractAbaqusNTENSMatrix( const std::vector< std::vector< T > > &full_abaqus_matrix,
-                                                                       const int &NDI, const int &NSHR ){
+    static_assert( isNTENSRoundTrip( ), "The NTENS expansion and contraction maps must be inverses" );
+
+    template< class Vector >
+    using ScalarType = std::remove_cv_t< std::remove_reference_t< decltype( std::declval< const Vector & >( )[ 0 ] ) > >;
+
+    template< class Container, typename = void >
+    struct HasSize : std::false_type{ };
+
+    template< class Container >
+    struct HasSize< Container, std::void_t< decltype( std::declval< const Container & >( ).size( ) ) > > : std::true_type{ };
+
+    template< class Matrix, typename = void >
+    struct HasExtents : std::false_type{ };
+
+    template< class Matrix >
+    struct HasExtents< Matrix, std::void_t< decltype( std::declval< const Matrix & >( ).height( ) ),
+                                            decltype( std::declval< const Matrix & >( ).width( ) ) > > : std::true_type{ };
+
+    template< class Matrix >
+    constexpr auto matrixEntry( Matrix &&matrix, const int &row, const int &col ) -> decltype( matrix( row, col ) ){
         /*!
-         * Contract NTENS type components from full Abaqus stress-type matrixes (6x6). ONLY APPLIES TO
-         * ABAQUS/STANDARD Voigt matrices, e.g. Jaumann stiffness matrix.
-         *
-         * See the Abaqus documentation > Introduction & Spatial Modeling > Conventions chapter > Convention used for stress
-         * and strain components.
-         *
-         * The stress vector components for Abaqus/Standard (UMAT) are
-         *
-         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{13}, \tau_{23} \right ) \f$
+         * Access a two dimensional array entry through the call operator, e.g. ``ColumnMajorView``
          *
-         * and the strain vector components match as
+         * \param &&matrix: The two dimensional array
+         * \param &row: The row index
+         * \param &col: The column index
+         */
+        return matrix( row, col );
+    }
+
+    template< class Matrix >
+    constexpr auto matrixEntry( Matrix &&matrix, const int &row, const int &col ) -> decltype( matrix[ row ][ col ] ){
+        /*!
+         * Access a two dimensional array entry through nested subscripts, e.g. a vector of vectors
          *
-         * \f$ \left ( \epsilon_{11}, \epsilon_{22}, \epsilon_{33}, \gamma_{12}, \gamma_{13}, \gamma_{23} \right ) \f$
+         * \param &&matrix: The two dimensional array
+         * \param &row: The row index
+         * \param &col: The column index
+         */
+        return matrix[ row ][ col ];
+    }
+
+    //! Removes the write-into overloads from overload resolution unless ``Output`` and ``Input`` are indexable vectors
+    template< class Output, class Input >
+    using EnableIfVectorOutput = std::void_t< decltype( std::declval< Output & >( )[ 0 ] = std::declval< ScalarType< Input > >( ) ) >;
+
+    //! Removes the write-into overloads from overload resolution unless ``Output`` and ``Input`` are two dimensional
+    //! arrays
+    template< class Output, class Input >
+    using EnableIfMatrixOutput = std::void_t< decltype( matrixEntry( std::declval< Output & >( ), 0, 0 ) =
+                                                        matrixEntry( std::declval< const Input & >( ), 0, 0 ) ) >;
+
+    template< class Matrix >
+    using MatrixScalarType = std::remove_cv_t< std::remove_reference_t< decltype( matrixEntry( std::declval< const Matrix & >( ), 0, 0 ) ) > >;
+
+    template< class Vector >
+    inline void checkSize( const Vector &vector, const std::size_t &size, const char *message ){
+        /*!
+         * Throw a ``std::length_error`` if a sized vector has fewer than size entries. Unsized types, e.g. pointers,
+         * are not checked. The check is removed when ``TARDIGRADE_ABAQUS_TOOLS_CHECK_SIZES`` is 0.
          *
-         * where components that are zero-valued by definition, e.g. plane stress, are omitted. The related matrixes are
-         * therefore ordered for Abaqus/Standard (UMAT) as
+         * \param &vector: The vector to check
+         * \param &size: The minimum number of entries
+         * \param *message: The error message
+         */
+        if constexpr ( checkSizes && HasSize< Vector >::value ){
+            if ( static_cast< std::size_t >( vector.size( ) ) < size ){
+                throw std::length_error( message );
+            }
+        }
+    }
+
+    template< class Matrix >
+    inline void checkSize( const Matrix &matrix, const std::size_t &height, const std::size_t &width, const char *message ){
+        /*!
+         * Throw a ``std::length_error`` if a sized two dimensional array has fewer than height rows or width columns.
+         * The check is removed when ``TARDIGRADE_ABAQUS_TOOLS_CHECK_SIZES`` is 0.
          *
-         * TODO: Update LaTeX formatting for a well aligned matrix
+         * \param &matrix: The two dimensional array to check, e.g. a view or a vector of vectors
+         * \param &height: The minimum number of rows
+         * \param &width: The minimum number of columns
+         * \param *message: The error message
+         */
+        if constexpr ( !checkSizes ){
+            return;
+        }
+        else if constexpr ( HasExtents< Matrix >::value ){
+            if ( static_cast< std::size_t >( matrix.height( ) ) < height || static_cast< std::size_t >( matrix.width( ) ) < width ){
+                throw std::length_error( message );
+            }
+        }
+        else if constexpr ( HasSize< Matrix >::value ){
+            checkSize( matrix, height, message );
+            for ( std::size_t row = 0; row < height; row++ ){
+                checkSize( matrix[ row ], width, message );
+            }
+        }
+    }
+
+    template< typename T, int HEIGHT = dynamicExtent, int WIDTH = dynamicExtent >
+    class ColumnMajorView{
+        /*!
+         * Non-owning view of a column major (Fortran) two dimensional array, e.g. the ``DDSDDE``, ``STATEV``, or
+         * ``PROPS`` pointers passed to a UMAT. Reads and writes go directly to the wrapped memory.
          *
-         * \f$ \left ( D_{1111}, D_{1122}, D_{1133}, D_{1112}, D_{1113}, D_{1123} \right ) \f$
-         * \f$ \left ( D_{2211}, D_{2222}, D_{2233}, D_{2212}, D_{2213}, D_{2223} \right ) \f$
-         * \f$ \left ( D_{3311}, D_{3322}, D_{3333}, D_{3312}, D_{3313}, D_{3323} \right ) \f$
-         * \f$ \left ( D_{1211}, D_{1222}, D_{1233}, D_{1212}, D_{1213}, D_{1223} \right ) \f$
-         * \f$ \left ( D_{1311}, D_{1322}, D_{1333}, D_{1312}, D_{1313}, D_{1323} \right ) \f$
-         * \f$ \left ( D_{2311}, D_{2322}, D_{2333}, D_{2312}, D_{2313}, D_{2323} \right ) \f$
+         * The extents may be fixed at compile time with the ``HEIGHT`` and ``WIDTH`` template parameters or left as
+         * ``tardigradeAbaqusTools::dynamicExtent`` and provided at construction.
          *
-         * \param &full_abaqus_matrix: a previously expanded abaqus NTENS matrix. Dimensions 6x6.
-         * \param &NDI: The number of direct components.
-         * \param &NSHR: The number of shear components.
-         * \returns matrix_contraction: c++ type vector of vectors with square shape of size NDI + NSHR.
+         * \param T: The scalar type. Use a const type for read-only views.
+         * \param HEIGHT: The compile time number of rows or ``dynamicExtent``
+         * \param WIDTH: The compile time number of columns or ``dynamicExtent``
          */
 
-        //Initialize contracted matrix to the appropriate dimensions
-        std::vector< std::vector< T > > matrix_contraction( NDI + NSHR, std::vector< T >( NDI + NSHR ) );
+        public:
 
-        //Loop non-zero direct component rows
-        for ( int row = 0; row < NDI; row++ ){
-            //Loop non-zero direct component columns
-            for ( int col = 0; col < NDI; col++ ){
-                matrix_contraction[ row ][ col ] = full_abaqus_matrix[ row ][ col ];
+            ColumnMajorView( T *column_major, const int &height, const int &width ) :
+                _data( column_major ), _height( height ), _width( width ){
+                /*!
+                 * \param *column_major: The pointer to the start of a column major array
+                 * \param &height: The height of the array, e.g. number of rows
+                 * \param &width: The width of the array, e.g. number of columns
+                 */
+                if ( checkSizes &&
+                     ( ( HEIGHT != dynamicExtent && height != HEIGHT ) || ( WIDTH != dynamicExtent && width != WIDTH ) ) ){
+                    throw std::length_error( "Column major view size must match the compile time extents" );
+                }
             }
-            //Loop non-zero shear component columns
-            for ( int col = 0; col < NSHR; col++ ){
-                matrix_contraction[ row ][ NDI + col ] = full_abaqus_matrix[ row ][ 3 + col ];
+
+            template< int H = HEIGHT, int W = WIDTH,
+                      typename = std::enable_if_t< ( H != dynamicExtent ) && ( W != dynamicExtent ) > >
+            explicit ColumnMajorView( T *column_major ) : _data( column_major ), _height( HEIGHT ), _width( WIDTH ){
+                /*!
+                 * \param *column_major: The pointer to the start of a column major array with compile time extents
+                 */
             }
-        }
 
-        //Loop non-zero shear component rows
-        for ( int row = 0; row < NSHR; row++ ){
-            //Loop non-zero direct component columns
-            for ( int col = 0; col < NDI; col++ ){
+            template< typename U, typename = std::enable_if_t< std::is_same< const U, T >::value > >
+            ColumnMajorView( const ColumnMajorView< U, HEIGHT, WIDTH > &view ) :
+                _data( view.data( ) ), _height( view.height( ) ), _width( view.width( ) ){
+                /*!
+                 * Convert a mutable view to a read-only view
+                 *
+                 * \param &view: The mutable view
+                 */
+            }
+
+            T &operator()( const int &row, const int &col ) const{
+                /*!
+                 * Access the array entry in the given row and column
+                 *
+                 * \param &row: The row index
+                 * \param &col: The column index
+                 */
+                return _data[ std::size_t( col ) * height( ) + row ];
+            }
+
+            T &operator[]( const std::size_t &index ) const{
+                /*!
+                 * Access the array entry by the column major storage index. Useful for one dimensional arrays such as
+                 * ``STRESS`` or ``STATEV``.
+                 *
+                 * \param &index: The column major storage index
+                 */
+                return _data[ index ];
+            }
+
+            int height( ) const{
+                /*!
+                 * \returns height: The number of rows
+                 */
+                return HEIGHT == dynamicExtent ? _height : HEIGHT;
+            }
+
+            int width( ) const{
+                /*!
+                 * \returns width: The number of columns
+                 */
+                return WIDTH == dynamicExtent ? _width : WIDTH;
+            }
+
+            std::size_t size( ) const{
+                /*!
+                 * \returns size: The number of array entries
+                 */
+                return std::size_t( height( ) ) * width( );
+            }
+
+            T *data( ) const{
+                /*!
+                 * \returns data: The pointer to the start of the wrapped array
+                 */
+                return _data;
+            }
+
+        private:
+
+            T *_data;
+
+            int _height;
+
+            int _width;
+
+    };
+
+    template< typename T, int HEIGHT = dynamicExtent, int WIDTH = dynamicExtent >
+    class RowMajorView{
+        /*!
+         * Non-owning view of a row major (c++) two dimensional array, e.g. the data of a ``std::vector`` storing a
+         * matrix in row major order. Provides the same interface as ``tardigradeAbaqusTools::ColumnMajorView``.
+         *
+         * \param T: The scalar type. Use a const type for read-only views.
+         * \param HEIGHT: The compile time number of rows or ``dynamicExtent``
+         * \param WIDTH: The compile time number of columns or ``dynamicExtent``
+         */
+
+        public:
+
+            RowMajorView( T *row_major, const int &height, const int &width ) :
+                _data( row_major ), _height( height ), _width( width ){
+                /*!
+                 * \param *row_major: The pointer to the start of a row major array
+                 * \param &height: The height of the array, e.g. number of rows
+                 * \param &width: The width of the array, e.g. number of columns
+                 */
+                if ( checkSizes &&
+                     ( ( HEIGHT != dynamicExtent && height != HEIGHT ) || ( WIDTH != dynamicExtent && width != WIDTH ) ) ){
+                    throw std::length_error( "Row major view size must match the compile time extents" );
+                }
+            }
+
+            template< int H = HEIGHT, int W = WIDTH,
+                      typename = std::enable_if_t< ( H != dynamicExtent ) && ( W != dynamicExtent ) > >
+            explicit RowMajorView( T *row_major ) : _data( row_major ), _height( HEIGHT ), _width( WIDTH ){
+                /*!
+                 * \param *row_major: The pointer to the start of a row major array with compile time extents
+                 */
+            }
+
+            template< typename U, typename = std::enable_if_t< std::is_same< const U, T >::value > >
+            RowMajorView( const RowMajorView< U, HEIGHT, WIDTH > &view ) :
+                _data( view.data( ) ), _height( view.height( ) ), _width( view.width( ) ){
+                /*!
+                 * Convert a mutable view to a read-only view
+                 *
+                 * \param &view: The mutable view
+                 */
+            }
+
+            T &operator()( const int &row, const int &col ) const{
+                /*!
+                 * Access the array entry in the given row and column
+                 *
+                 * \param &row: The row index
+                 * \param &col: The column index
+                 */
+                return _data[ std::size_t( row ) * width( ) + col ];
+            }
+
+            T &operator[]( const std::size_t &index ) const{
+                /*!
+                 * Access the array entry by the row major storage index
+                 *
+                 * \param &index: The row major storage index
+                 */
+                return _data[ index ];
+            }
+
+            int height( ) const{
+                /*!
+                 * \returns height: The number of rows
+                 */
+                return HEIGHT == dynamicExtent ? _height : HEIGHT;
+            }
+
+            int width( ) const{
+                /*!
+                 * \returns width: The number of columns
+                 */
+                return WIDTH == dynamicExtent ? _width : WIDTH;
+            }
+
+            std::size_t size( ) const{
+                /*!
+                 * \returns size: The number of array entries
+                 */
+                return std::size_t( height( ) ) * width( );
+            }
+
+            T *data( ) const{
+                /*!
+                 * \returns data: The pointer to the start of the wrapped array
+                 */
+                return _data;
+            }
+
+        private:
+
+            T *_data;
+
+            int _height;
+
+            int _width;
+
+    };
+
+    template< class Vector >
+    class FullNTENSTensorExpression;
+
+    template< class Tensor >
+    class NTENSVectorExpression;
+
+    template< class Operand >
+    struct ExpressionOperand{
+        //! Containers and views are held by reference
+        using type = const Operand &;
+    };
+
+    template< class T >
+    struct ExpressionOperand< T * >{
+        //! Pointers are held by value
+        using type = T * const;
+    };
+
+    template< class Vector >
+    struct ExpressionOperand< FullNTENSTensorExpression< Vector > >{
+        //! Nested expressions are held by value so that chained temporaries remain valid
+        using type = const FullNTENSTensorExpression< Vector >;
+    };
+
+    template< class Tensor >
+    struct ExpressionOperand< NTENSVectorExpression< Tensor > >{
+        //! Nested expressions are held by value so that chained temporaries remain valid
+        using type = const NTENSVectorExpression< Tensor >;
+    };
+
+    template< class Vector >
+    class FullNTENSTensorExpression{
+        /*!
+         * Lazy row-major full 3x3 tensor of a contracted Abaqus stress-type vector of length NDI + NSHR. Each component is
+         * read from the operand through the composite ``fullTensorNTENSIndex`` map when accessed, so neither the full
+         * Abaqus vector of length 6 nor the full tensor is stored.
+         *
+         * Use ``tardigradeAbaqusTools::lazyExpandFullNTENSTensor`` to construct the expression.
+         *
+         * \param Vector: Any indexable type, e.g. the ``STRESS`` pointer, ``std::vector``, ``std::array``,
+         *     ``ColumnMajorView``, or another expression.
+         */
+
+        public:
+
+            using value_type = ScalarType< Vector >;
+
+            constexpr FullNTENSTensorExpression( const Vector &abaqus_vector, const std::array< int, 9 > &index_map ) :
+                _abaqus_vector( abaqus_vector ), _index_map( index_map ){
+                /*!
+                 * \param &abaqus_vector: an abaqus stress-type vector with no by-definition-zero components
+                 * \param &index_map: The contracted vector index of each full tensor component or -1 for
+                 *     by-definition-zero components
+                 */
+            }
+
+            constexpr value_type operator[]( const unsigned int &index ) const{
+                /*!
+                 * Access the row-major full tensor component
+                 *
+                 * \param &index: The row-major full tensor index
+                 */
+                return _index_map[ index ] < 0 ? value_type( 0 ) : value_type( _abaqus_vector[ _index_map[ index ] ] );
+            }
+
+            constexpr value_type operator()( const unsigned int &row, const unsigned int &col ) const{
+                /*!
+                 * Access the full tensor component in the given row and column
+                 *
+                 * \param &row: The row index
+                 * \param &col: The column index
+                 */
+                return ( *this )[ 3 * row + col ];
+            }
+
+            static constexpr unsigned int size( ){
+                /*!
+                 * Get the number of full tensor components
+                 */
+                return 9;
+            }
+
+            template< class Output >
+            void evaluate( Output &full_tensor ) const{
+                /*!
+                 * Write the row-major full tensor in a single pass
+                 *
+                 * \param &full_tensor: Any indexable output with at least 9 entries
+                 */
+                for ( unsigned int index = 0; index < 9; index++ ){
+                    full_tensor[ index ] = ( *this )[ index ];
+                }
+            }
+
+            operator std::array< value_type, 9 >( ) const{
+                /*!
+                 * Evaluate the expression as a row-major array
+                 */
+                std::array< value_type, 9 > full_tensor;
+                evaluate( full_tensor );
+                return full_tensor;
+            }
+
+            operator std::vector< value_type >( ) const{
+                /*!
+                 * Evaluate the expression as a row-major vector
+                 */
+                std::vector< value_type > full_tensor( 9 );
+                evaluate( full_tensor );
+                return full_tensor;
+            }
+
+        private:
+
+            typename ExpressionOperand< Vector >::type _abaqus_vector;
+
+            std::array< int, 9 > _index_map;
+
+    };
+
+    template< class Tensor >
+    class NTENSVectorExpression{
+        /*!
+         * Lazy contracted Abaqus stress-type vector of length NDI + NSHR of a row-major full 3x3 tensor. Each component is
+         * read from the operand through the composite ``NTENSFullTensorIndex`` map when accessed, so the full Abaqus
+         * vector of length 6 is not stored.
+         *
+         * Use ``tardigradeAbaqusTools::lazyContractFullNTENSTensor`` to construct the expression.
+         *
+         * \param Tensor: Any indexable row-major full tensor type, e.g. ``std::vector``, ``std::array``, or another
+         *     expression.
+         */
+
+        public:
+
+            using value_type = ScalarType< Tensor >;
+
+            constexpr NTENSVectorExpression( const Tensor &full_tensor, const std::array< unsigned int, 6 > &index_map,
+                                             const unsigned int &ntens ) :
+                _full_tensor( full_tensor ), _index_map( index_map ), _ntens( ntens ){
+                /*!
+                 * \param &full_tensor: The row-major full tensor
+                 * \param &index_map: The full tensor index of each contracted vector component
+                 * \param &ntens: The number of contracted vector components, NDI + NSHR
+                 */
+            }
+
+            constexpr value_type operator[]( const unsigned int &index ) const{
+                /*!
+                 * Access the contracted vector component
+                 *
+                 * \param &index: The contracted vector index
+                 */
+                return _full_tensor[ _index_map[ index ] ];
+            }
+
+            constexpr unsigned int size( ) const{
+                /*!
+                 * Get the number of contracted vector components, NDI + NSHR
+                 */
+                return _ntens;
+            }
+
+            template< class Output >
+            void evaluate( Output &abaqus_vector ) const{
+                /*!
+                 * Write the contracted vector in a single pass
+                 *
+                 * \param &abaqus_vector: Any indexable output with at least NDI + NSHR entries
+                 */
+                for ( unsigned int index = 0; index < _ntens; index++ ){
+                    abaqus_vector[ index ] = ( *this )[ index ];
+                }
+            }
+
+            operator std::array< value_type, 6 >( ) const{
+                /*!
+                 * Evaluate the expression as an array. The contracted vector occupies the leading NDI + NSHR entries
+                 * and the trailing entries are zero.
+                 */
+                std::array< value_type, 6 > abaqus_vector = { };
+                evaluate( abaqus_vector );
+                return abaqus_vector;
+            }
+
+            operator std::vector< value_type >( ) const{
+                /*!
+                 * Evaluate the expression as a vector of length NDI + NSHR
+                 */
+                std::vector< value_type > abaqus_vector( _ntens );
+                evaluate( abaqus_vector );
+                return abaqus_vector;
+            }
+
+        private:
+
+            typename ExpressionOperand< Tensor >::type _full_tensor;
+
+            std::array< unsigned int, 6 > _index_map;
+
+            unsigned int _ntens;
+
+    };
+
+    template< class Vector >
+    constexpr FullNTENSTensorExpression< Vector > lazyExpandFullNTENSTensor( const Vector &abaqus_vector,
+                                                                             const int &NDI, const int &NSHR,
+                                                                             const bool abaqus_standard = true ){
+        /*!
+         * Lazily expand the full 3x3 tensor from the contracted Abaqus stress-type vector of length NDI + NSHR. The
+         * expansion to the full Abaqus vector and the full tensor are fused into one index map and no intermediate
+         * vectors are created, e.g.
+         *
+         *     std::vector< double > full_tensor = tardigradeAbaqusTools::lazyExpandFullNTENSTensor( STRESS, NDI, NSHR );
+         *
+         * The expression holds a reference to ``abaqus_vector``, which must outlive it.
+         *
+         * \param &abaqus_vector: an abaqus stress-type vector with no by-definition-zero components. Length NDI + NSHR.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns The row-major full tensor expression
+         */
+        return FullNTENSTensorExpression< Vector >( abaqus_vector, fullTensorNTENSIndex( NDI, NSHR, abaqus_standard ) );
+    }
+
+    template< int NDI, int NSHR, class Vector >
+    constexpr FullNTENSTensorExpression< Vector > lazyExpandFullNTENSTensor( const Vector &abaqus_vector,
+                                                                             const bool abaqus_standard = true ){
+        /*!
+         * Lazily expand the full 3x3 tensor from the contracted Abaqus stress-type vector with compile time NDI and NSHR.
+         * The composite index map is a compile time constant.
+         *
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param &abaqus_vector: an abaqus stress-type vector with no by-definition-zero components. Length NDI + NSHR.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns The row-major full tensor expression
+         */
+        return FullNTENSTensorExpression< Vector >( abaqus_vector, abaqus_standard ? fullTensorNTENSMap< NDI, NSHR, true >
+                                                                                   : fullTensorNTENSMap< NDI, NSHR, false > );
+    }
+
+    template< class Tensor >
+    constexpr NTENSVectorExpression< Tensor > lazyContractFullNTENSTensor( const Tensor &full_tensor,
+                                                                           const int &NDI, const int &NSHR,
+                                                                           const bool abaqus_standard = true ){
+        /*!
+         * Lazily contract a row-major full 3x3 tensor into an Abaqus stress-type vector of length NDI + NSHR. The
+         * contraction to the full Abaqus vector and the contracted vector are fused into one index map and no
+         * intermediate vectors are created.
+         *
+         * The expression holds a reference to ``full_tensor``, which must outlive it. Expressions are held by value, so
+         * chains such as ``lazyContractFullNTENSTensor( lazyExpandFullNTENSTensor( STRESS, NDI, NSHR ), NDI, NSHR )`` are
+         * safe.
+         *
+         * \param &full_tensor: c++ type row-major full tensor. Length 9.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns The contracted abaqus stress-type vector expression
+         */
+        return NTENSVectorExpression< Tensor >( full_tensor, NTENSFullTensorIndex( NDI, NSHR, abaqus_standard ), NDI + NSHR );
+    }
+
+    template< int NDI, int NSHR, class Tensor >
+    constexpr NTENSVectorExpression< Tensor > lazyContractFullNTENSTensor( const Tensor &full_tensor,
+                                                                           const bool abaqus_standard = true ){
+        /*!
+         * Lazily contract a row-major full 3x3 tensor into an Abaqus stress-type vector with compile time NDI and NSHR.
+         * The composite index map is a compile time constant.
+         *
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param &full_tensor: c++ type row-major full tensor. Length 9.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns The contracted abaqus stress-type vector expression
+         */
+        return NTENSVectorExpression< Tensor >( full_tensor, abaqus_standard ? NTENSFullTensorMap< NDI, NSHR, true >
+                                                                             : NTENSFullTensorMap< NDI, NSHR, false >,
+                                                NDI + NSHR );
+    }
+
+    inline char *FtoCString( int stringLength, const char* fString ){
+        /*!
+         * Converts a Fortran string to C-string. Trims trailing white space during processing.
+         *
+         * Code excerpt from a c++ Abaqus FILM subroutine in the Abaqus Knowledge Base:
+         * https://kb.dsxclient.3ds.com/mashup-ui/page/resultqa?from=search%3fq%3dwriting%2bsubroutine%2bc%252B%252B&id=QA00000008005e&q=writing%20subroutine%20c%2B%2B
+         *
+         * TODO: update coding style to match project.
+         *
+         * The caller owns the returned C-string and must ``delete[]`` it. Prefer
+         * ``tardigradeAbaqusTools::FtoStringView`` or ``tardigradeAbaqusTools::internMaterialName`` in per material point
+         * code because they do not allocate.
+         *
+         * \param stringLength: The length of the Fortran string.
+         * \param *fString: The pointer to the start of the Fortran string.
+         */
+        int stringLen = stringLength;
+        for ( int k1 = stringLength - 1; k1 >= 0; k1-- )
+    	{
+    	    if ( fString[ k1 ] != ' ' ) break;
+    	    stringLen = k1;
+    	}
+        char* cString  = new char [ stringLen + 1 ];
+        memcpy ( cString, fString, stringLen );
+        cString[ stringLen ] = '\0';
+        return cString;
+    }
+
+    inline std::string_view FtoStringView( const int &stringLength, const char *fString ){
+        /*!
+         * Trim the trailing white space of a Fortran string without copying. The returned view points directly into the
+         * Fortran buffer, e.g. the UMAT ``CMNAME`` argument, and is only valid while that buffer is.
+         *
+         * \param &stringLength: The length of the Fortran string. Negative lengths are treated as empty strings.
+         * \param *fString: The pointer to the start of the Fortran string.
+         * \returns view: The trimmed string view
+         */
+        int stringLen = std::max( stringLength, 0 );
+        while ( stringLen > 0 && fString[ stringLen - 1 ] == ' ' ){
+            stringLen--;
+        }
+        return std::string_view( fString, stringLen );
+    }
+
+    class MaterialNameCache{
+        /*!
+         * Intern trimmed Fortran strings. The names are stored once per distinct content in node-stable storage and are
+         * never modified, so every returned view stays valid until the cache is cleared. A secondary index keyed on the
+         * buffer pointer and length makes repeat lookups of the same buffer, e.g. the ``CMNAME`` argument across
+         * material points, a hash lookup and a comparison instead of a copy.
+         *
+         * The cached name is compared against the buffer on every lookup, so a buffer that is re-used for a different
+         * name is re-interned rather than returning a stale name. The pointer index is bounded by
+         * ``maxPointers`` and is reset when full; the interned names are kept.
+         */
+
+        public:
+
+            //! Maximum number of buffer addresses in the pointer index
+            static constexpr std::size_t maxPointers = 1024;
+
+            std::string_view intern( const int &stringLength, const char *fString ){
+                /*!
+                 * Return the interned, trimmed copy of a Fortran string
+                 *
+                 * \param &stringLength: The length of the Fortran string.
+                 * \param *fString: The pointer to the start of the Fortran string.
+                 * \returns name: A view of the interned name. Valid until the cache is cleared or destroyed.
+                 */
+                const std::string_view trimmed = FtoStringView( stringLength, fString );
+                const Key key{ fString, stringLength };
+
+                auto pointer = _pointers.find( key );
+                if ( pointer != _pointers.end( ) && pointer->second == trimmed ){
+                    return pointer->second;
+                }
+
+                const std::string_view name = *_names.emplace( trimmed ).first;
+                if ( pointer != _pointers.end( ) ){
+                    pointer->second = name;
+                }
+                else{
+                    if ( _pointers.size( ) >= maxPointers ){
+                        _pointers.clear( );
+                    }
+                    _pointers.emplace( key, name );
+                }
+                return name;
+            }
+
+            std::size_t size( ) const{
+                /*!
+                 * \returns size: The number of distinct interned names
+                 */
+                return _names.size( );
+            }
+
+            void clear( ){
+                /*!
+                 * Remove all interned names. Invalidates every returned view.
+                 */
+                _pointers.clear( );
+                _names.clear( );
+            }
+
+        private:
+
+            struct Key{
+                const char *pointer;
+                int length;
+                bool operator==( const Key &other ) const{
+                    return pointer == other.pointer && length == other.length;
+                }
+            };
+
+            struct KeyHash{
+                std::size_t operator()( const Key &key ) const{
+                    return std::hash< const char * >( )( key.pointer ) ^ ( std::hash< int >( )( key.length ) << 1 );
+                }
+            };
+
+            std::unordered_set< std::string > _names;
+
+            std::unordered_map< Key, std::string_view, KeyHash > _pointers;
+
+    };
+
+    inline std::string_view internMaterialName( const int &stringLength, const char *fString ){
+        /*!
+         * Intern a trimmed Fortran string, e.g. the UMAT ``CMNAME`` argument, in a per-thread
+         * ``tardigradeAbaqusTools::MaterialNameCache``. No locks are taken and repeat lookups do not allocate.
+         *
+         * \param &stringLength: The length of the Fortran string.
+         * \param *fString: The pointer to the start of the Fortran string.
+         * \returns name: A view of the interned name. Valid for the lifetime of the calling thread.
+         */
+        thread_local MaterialNameCache cache;
+        return cache.intern( stringLength, fString );
+    }
+
+    //! Default capacity in bytes of the per-thread bump arena
+    constexpr std::size_t defaultArenaCapacity = 65536;
+
+    class BumpArena{
+        /*!
+         * Linear (bump) memory arena for the short lived vectors returned by the converters in a single UMAT or VUMAT
+         * call. Allocation advances an offset into a fixed buffer without locking. Requests that do not fit in the
+         * buffer fall back to the global heap. Memory in the buffer is reclaimed when the most recent allocation is
+         * released or when the arena is reset.
+         *
+         * Use one arena per thread and call ``reset`` at the end of each material call, after every container
+         * allocated from the arena has been destroyed, e.g.
+         *
+         *     tardigradeAbaqusTools::BumpArena &arena = tardigradeAbaqusTools::threadArena( );
+         *     {
+         *         tardigradeAbaqusTools::ArenaAllocator< double > allocator( arena );
+         *         std::vector< double, tardigradeAbaqusTools::ArenaAllocator< double > > stress( STRESS, STRESS + NTENS, allocator );
+         *         auto full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( stress, NDI, NSHR );
+         *         ...
+         *     }
+         *     arena.reset( );
+         */
+
+        public:
+
+            explicit BumpArena( const std::size_t &capacity = defaultArenaCapacity ) :
+                _owned( new unsigned char[ capacity ] ), _buffer( _owned.get( ) ), _capacity( capacity ){
+                /*!
+                 * Construct an arena that owns its buffer
+                 *
+                 * \param &capacity: The size of the buffer in bytes
+                 */
+            }
+
+            BumpArena( void *buffer, const std::size_t &capacity ) :
+                _buffer( static_cast< unsigned char* >( buffer ) ), _capacity( capacity ){
+                /*!
+                 * Construct an arena on a caller provided buffer, e.g. a stack array
+                 *
+                 * \param *buffer: The pointer to the start of the buffer. Must outlive the arena.
+                 * \param &capacity: The size of the buffer in bytes
+                 */
+            }
+
+            BumpArena( const BumpArena & ) = delete;
+
+            BumpArena &operator=( const BumpArena & ) = delete;
+
+            void *allocate( const std::size_t &bytes, const std::size_t &alignment = alignof( std::max_align_t ) ){
+                /*!
+                 * Allocate memory from the buffer or from the global heap when the buffer is exhausted
+                 *
+                 * \param &bytes: The number of bytes to allocate
+                 * \param &alignment: The required alignment. Must be a power of two.
+                 * \returns A pointer to the allocated memory
+                 */
+                const std::size_t address = reinterpret_cast< std::size_t >( _buffer ) + _offset;
+                const std::size_t start = _offset + ( ( alignment - address % alignment ) % alignment );
+                if ( start + bytes > _capacity ){
+                    _heap_allocations++;
+                    if ( alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ){
+                        return ::operator new( bytes, std::align_val_t( alignment ) );
+                    }
+                    return ::operator new( bytes );
+                }
+                _offset = start + bytes;
+                return _buffer + start;
+            }
+
+            void deallocate( void *pointer, const std::size_t &bytes,
+                             const std::size_t &alignment = alignof( std::max_align_t ) ) noexcept{
+                /*!
+                 * Release memory. Buffer memory is reclaimed only if it is the most recent allocation.
+                 *
+                 * \param *pointer: The pointer returned by ``allocate``
+                 * \param &bytes: The number of bytes passed to ``allocate``
+                 * \param &alignment: The alignment passed to ``allocate``
+                 */
+                unsigned char *memory = static_cast< unsigned char* >( pointer );
+                const std::less< const unsigned char* > before;
+                if ( before( memory, _buffer ) || !before( memory, _buffer + _capacity ) ){
+                    if ( alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ){
+                        ::operator delete( pointer, std::align_val_t( alignment ) );
+                    }
+                    else{
+                        ::operator delete( pointer );
+                    }
+                    return;
+                }
+                if ( memory + bytes == _buffer + _offset ){
+                    _offset = memory - _buffer;
+                }
+            }
+
+            void reset( ) noexcept{
+                /*!
+                 * Release all buffer memory. Every container allocated from the buffer must already be destroyed.
+                 */
+                _offset = 0;
+            }
+
+            std::size_t used( ) const noexcept{
+                /*!
+                 * Get the number of buffer bytes in use
+                 */
+                return _offset;
+            }
+
+            std::size_t capacity( ) const noexcept{
+                /*!
+                 * Get the size of the buffer in bytes
+                 */
+                return _capacity;
+            }
+
+            std::size_t heapAllocations( ) const noexcept{
+                /*!
+                 * Get the number of requests that did not fit in the buffer and fell back to the global heap
+                 */
+                return _heap_allocations;
+            }
+
+        private:
+
+            std::unique_ptr< unsigned char[] > _owned;
+
+            unsigned char *_buffer;
+
+            std::size_t _capacity;
+
+            std::size_t _offset = 0;
+
+            std::size_t _heap_allocations = 0;
+
+    };
+
+    inline BumpArena &threadArena( ){
+        /*!
+         * Get the calling thread's bump arena with ``defaultArenaCapacity`` bytes. Arenas are never shared between
+         * threads, so allocations do not contend on the global heap lock.
+         *
+         * \returns The per-thread arena
+         */
+        thread_local BumpArena arena;
+        return arena;
+    }
+
+    template< typename T >
+    class ArenaAllocator{
+        /*!
+         * Standard library allocator drawing from a ``BumpArena``. Pass it to the ``std::vector`` arguments of the
+         * converters and the returned vectors are allocated from the same arena.
+         *
+         * \param T: The allocated type
+         */
+
+        public:
+
+            using value_type = T;
+
+            ArenaAllocator( BumpArena &arena ) noexcept : _arena( &arena ){
+                /*!
+                 * \param &arena: The arena to allocate from. Must outlive the allocator and its containers.
+                 */
+            }
+
+            template< typename U >
+            ArenaAllocator( const ArenaAllocator< U > &other ) noexcept : _arena( other.arena( ) ){
+                /*!
+                 * Rebind an allocator of another type to the same arena
+                 *
+                 * \param &other: The allocator to rebind
+                 */
+            }
+
+            T *allocate( const std::size_t n ){
+                /*!
+                 * Allocate uninitialized storage for n objects
+                 *
+                 * \param n: The number of objects
+                 */
+                return static_cast< T* >( _arena->allocate( n * sizeof( T ), alignof( T ) ) );
+            }
+
+            void deallocate( T *pointer, const std::size_t n ) noexcept{
+                /*!
+                 * Release the storage of n objects
+                 *
+                 * \param *pointer: The pointer returned by ``allocate``
+                 * \param n: The number of objects
+                 */
+                _arena->deallocate( pointer, n * sizeof( T ), alignof( T ) );
+            }
+
+            BumpArena *arena( ) const noexcept{
+                /*!
+                 * Get the arena
+                 */
+                return _arena;
+            }
+
+        private:
+
+            BumpArena *_arena;
+
+    };
+
+    template< typename T, typename U >
+    inline bool operator==( const ArenaAllocator< T > &lhs, const ArenaAllocator< U > &rhs ) noexcept{
+        /*!
+         * Allocators are equal when they draw from the same arena
+         */
+        return lhs.arena( ) == rhs.arena( );
+    }
+
+    template< typename T, typename U >
+    inline bool operator!=( const ArenaAllocator< T > &lhs, const ArenaAllocator< U > &rhs ) noexcept{
+        /*!
+         * Allocators are equal when they draw from the same arena
+         */
+        return !( lhs == rhs );
+    }
+
+    //! Removes the overloads with an allocator argument from overload resolution unless ``Allocator`` allocates ``T``
+    template< class Allocator, typename T >
+    using EnableIfAllocator = std::enable_if_t< std::is_same< typename Allocator::value_type, T >::value >;
+
+    //! Row major vector of vectors where the rows and the outer vector are allocated by ``Allocator``
+    template< typename T, class Allocator = std::allocator< T > >
+    using VectorOfVectors = std::vector< std::vector< T, Allocator >,
+                                         typename std::allocator_traits< Allocator >::template rebind_alloc< std::vector< T, Allocator > > >;
+
+    template< typename T, class Allocator >
+    inline VectorOfVectors< T, Allocator > allocateVectorOfVectors( const int &height, const int &width,
+                                                                    const Allocator &allocator ){
+        /*!
+         * Allocate a zero valued row major vector of vectors with a single allocator for the rows and the outer vector
+         *
+         * \param &height: The number of rows
+         * \param &width: The number of columns
+         * \param &allocator: The row allocator. Rebound for the outer vector.
+         * \returns A height by width vector of vectors
+         */
+        VectorOfVectors< T, Allocator > matrix( allocator );
+        matrix.reserve( height );
+        for ( int row = 0; row < height; row++ ){
+            matrix.emplace_back( width, T( 0 ), allocator );
+        }
+        return matrix;
+    }
+
+    template< typename T = double >
+    struct PointWorkspace{
+        /*!
+         * Preallocated conversion buffers and derived data owned by a single element integration point. The buffers
+         * keep their storage across increments and only the cache flags are reset when the workspace is invalidated.
+         *
+         * \param T: The scalar type
+         */
+
+        //! Row-major full stress tensor
+        std::array< T, 9 > stress = { };
+
+        //! Row-major full strain tensor
+        std::array< T, 9 > strain = { };
+
+        //! Row-major full strain increment tensor
+        std::array< T, 9 > strain_increment = { };
+
+        //! Row-major 9x9 full tangent
+        std::array< T, 81 > tangent = { };
+
+        //! Cached copy of the expanded state variables
+        std::vector< T > statev;
+
+        //! True when ``statev`` holds the state variables of the current increment
+        bool statev_valid = false;
+
+        //! Workspace generation the point data was last validated in
+        unsigned long generation = 0;
+
+        const std::vector< T > &stateVariables( const T *STATEV, const int &NSTATV ){
+            /*!
+             * Get the cached state variables of the current increment, copying them from the Abaqus ``STATEV`` array on
+             * the first request after an invalidation. Repeat requests do not copy or allocate.
+             *
+             * \param *STATEV: The pointer to the start of the Abaqus ``STATEV`` array
+             * \param &NSTATV: The number of state variables
+             * \returns The cached state variables
+             */
+            if ( !statev_valid || statev.size( ) != static_cast< std::size_t >( NSTATV ) ){
+                statev.assign( STATEV, STATEV + NSTATV );
+                statev_valid = true;
+            }
+            return statev;
+        }
+
+        void invalidate( ){
+            /*!
+             * Mark the derived data of the point as stale. The buffer storage is kept.
+             */
+            statev_valid = false;
+        }
+
+    };
+
+    template< typename T = double >
+    class Workspace{
+        /*!
+         * Per-thread store of ``PointWorkspace`` buffers keyed by the element number, integration point, layer, and
+         * section point. Solid elements use layer and section point 1.
+         *
+         * A workspace is never shared between threads, see ``tardigradeAbaqusTools::threadWorkspace``, so the lookups
+         * take no locks. Stale point data is detected with a generation counter: ``beginIncrement`` advances the
+         * generation whenever the ``KSTEP``/``KINC`` pair changes and each point is invalidated lazily the first time it
+         * is requested in the new generation.
+         *
+         * Abaqus re-attempts a cut back increment with the same ``KINC``. Call ``invalidate`` before re-using derived
+         * data that depends on more than the converged state at the start of the increment.
+         *
+         * \param T: The scalar type
+         */
+
+        public:
+
+            bool beginIncrement( const int &KSTEP, const int &KINC ){
+                /*!
+                 * Lifetime hook for the start of a UMAT call. Invalidates all point data when the step or increment
+                 * changed since the previous call on this thread.
+                 *
+                 * \param &KSTEP: The Abaqus step number
+                 * \param &KINC: The Abaqus increment number
+                 * \returns True if a new increment started
+                 */
+                if ( ( KSTEP == _kstep ) && ( KINC == _kinc ) ){
+                    return false;
+                }
+                _kstep = KSTEP;
+                _kinc = KINC;
+                invalidate( );
+                return true;
+            }
+
+            PointWorkspace< T > &sectionPoint( const int &NOEL, const int &NPT, const int &LAYER, const int &KSPT ){
+                /*!
+                 * Get the workspace of a shell or composite section point, creating it on the first request
+                 *
+                 * \param &NOEL: The element number
+                 * \param &NPT: The integration point number
+                 * \param &LAYER: The layer number
+                 * \param &KSPT: The section point number within the layer
+                 * \returns The section point workspace. Valid until ``clear`` is called or the thread exits.
+                 */
+                PointWorkspace< T > &point_workspace = _points[ Key{ NOEL, NPT, LAYER, KSPT } ];
+                if ( point_workspace.generation != _generation ){
+                    point_workspace.invalidate( );
+                    point_workspace.generation = _generation;
+                }
+                return point_workspace;
+            }
+
+            PointWorkspace< T > &point( const int &NOEL, const int &NPT ){
+                /*!
+                 * Get the workspace of a solid element integration point, i.e. layer and section point 1, creating it
+                 * on the first request
+                 *
+                 * \param &NOEL: The element number
+                 * \param &NPT: The integration point number
+                 * \returns The integration point workspace. Valid until ``clear`` is called or the thread exits.
+                 */
+                return sectionPoint( NOEL, NPT, 1, 1 );
+            }
+
+            PointWorkspace< T > &point( const int &NOEL, const int &NPT, const int &KSTEP, const int &KINC ){
+                /*!
+                 * Start the increment, see ``beginIncrement``, and get the workspace of a solid element integration
+                 * point
+                 *
+                 * \param &NOEL: The element number
+                 * \param &NPT: The integration point number
+                 * \param &KSTEP: The Abaqus step number
+                 * \param &KINC: The Abaqus increment number
+                 * \returns The integration point workspace. Valid until ``clear`` is called or the thread exits.
+                 */
+                beginIncrement( KSTEP, KINC );
+                return sectionPoint( NOEL, NPT, 1, 1 );
+            }
+
+            PointWorkspace< T > &point( const int &NOEL, const int &NPT, const int &LAYER, const int &KSPT,
+                                        const int &KSTEP, const int &KINC ){
+                /*!
+                 * Start the increment, see ``beginIncrement``, and get the workspace of a section point. The arguments
+                 * follow the UMAT argument order.
+                 *
+                 * \param &NOEL: The element number
+                 * \param &NPT: The integration point number
+                 * \param &LAYER: The layer number
+                 * \param &KSPT: The section point number within the layer
+                 * \param &KSTEP: The Abaqus step number
+                 * \param &KINC: The Abaqus increment number
+                 * \returns The section point workspace. Valid until ``clear`` is called or the thread exits.
+                 */
+                beginIncrement( KSTEP, KINC );
+                return sectionPoint( NOEL, NPT, LAYER, KSPT );
+            }
+
+            void invalidate( ){
+                /*!
+                 * Mark the derived data of every point as stale without releasing the buffers
+                 */
+                _generation++;
+            }
+
+            void clear( ){
+                /*!
+                 * Release all point workspaces and forget the current increment
+                 */
+                _points.clear( );
+                _kstep = -1;
+                _kinc = -1;
+                _generation++;
+            }
+
+            std::size_t size( ) const{
+                /*!
+                 * \returns size: The number of integration point workspaces
+                 */
+                return _points.size( );
+            }
+
+            unsigned long generation( ) const{
+                /*!
+                 * \returns generation: The current invalidation generation
+                 */
+                return _generation;
+            }
+
+        private:
+
+            struct Key{
+                int noel;
+                int npt;
+                int layer;
+                int kspt;
+                bool operator==( const Key &other ) const{
+                    return noel == other.noel && npt == other.npt && layer == other.layer && kspt == other.kspt;
+                }
+            };
+
+            struct KeyHash{
+                std::size_t operator()( const Key &key ) const{
+                    std::size_t hash = std::hash< int >( )( key.noel );
+                    for ( const int &value : { key.npt, key.layer, key.kspt } ){
+                        hash ^= std::hash< int >( )( value ) + 0x9e3779b9 + ( hash << 6 ) + ( hash >> 2 );
+                    }
+                    return hash;
+                }
+            };
+
+            std::unordered_map< Key, PointWorkspace< T >, KeyHash > _points;
+
+            int _kstep = -1;
+
+            int _kinc = -1;
+
+            unsigned long _generation = 1;
+
+    };
+
+    template< typename T = double >
+    inline Workspace< T > &threadWorkspace( ){
+        /*!
+         * Get the calling thread's integration point workspace. Workspaces are never shared between threads, so
+         * concurrent UMAT calls do not need to lock.
+         *
+         * \param T: The scalar type
+         * \returns The per-thread workspace
+         */
+        thread_local Workspace< T > workspace;
+        return workspace;
+    }
+
+    template< class... Variables >
+    class StateVariableLayout{
+        /*!
+         * Compile time layout of named state variables in the Abaqus ``STATEV``, ``stateOld``, and ``stateNew`` arrays.
+         *
+         * Each variable is a tag type with a ``static constexpr int components`` member, e.g.
+         *
+         * \code{.cpp}
+         * struct PlasticStrain{ static constexpr int components = 6; };
+         * struct EquivalentPlasticStrain{ static constexpr int components = 1; };
+         * using Layout = tardigradeAbaqusTools::StateVariableLayout< PlasticStrain, EquivalentPlasticStrain >;
+         * \endcode
+         *
+         * The variables are stored in declaration order. In the column major VUMAT ``stateOld( nblock, nstatev )`` array
+         * each component is a contiguous column of ``nblock`` values, so every variable is a contiguous span of
+         * ``nblock * components`` values.
+         *
+         * \param Variables: The state variable tag types
+         */
+
+        public:
+
+            //! The number of named state variables
+            static constexpr int count = sizeof...( Variables );
+
+            //! The number of state variable components, i.e. the minimum ``NSTATV``
+            static constexpr int size = ( 0 + ... + Variables::components );
+
+            //! True if ``Variable`` is part of the layout
+            template< class Variable >
+            static constexpr bool contains = ( std::is_same_v< Variable, Variables > || ... );
+
+            template< class Variable >
+            static constexpr int offset( ){
+                /*!
+                 * \param Variable: The state variable tag type
+                 * \returns offset: The state variable index of the first component of the variable
+                 */
+                static_assert( contains< Variable >, "The state variable is not part of the layout" );
+                int offset = 0;
+                bool found = false;
+                ( ( found = found || std::is_same_v< Variable, Variables >, offset += found ? 0 : Variables::components ), ... );
+                return offset;
+            }
+
+            template< class Variable >
+            static constexpr int components( ){
+                /*!
+                 * \param Variable: The state variable tag type
+                 * \returns components: The number of components of the variable
+                 */
+                static_assert( contains< Variable >, "The state variable is not part of the layout" );
+                return Variable::components;
+            }
+
+            template< class... Copied, typename T >
+            static void copy( T *state_new, const T *state_old, const int &nblock = 1 ){
+                /*!
+                 * Copy the listed variables from the old to the new state with one ``memcpy`` per variable
+                 *
+                 * \param Copied: The state variable tag types to copy
+                 * \param *state_new: The pointer to the start of the column major ``stateNew`` or ``STATEV`` array
+                 * \param *state_old: The pointer to the start of the column major ``stateOld`` array
+                 * \param &nblock: The number of material points in the block
+                 */
+                ( memcpy( state_new + offset< Copied >( ) * nblock, state_old + offset< Copied >( ) * nblock,
+                          sizeof( T ) * nblock * Copied::components ), ... );
+            }
+
+            template< class... Changed, typename T >
+            static void copyUnchanged( T *state_new, const T *state_old, const int &nblock = 1 ){
+                /*!
+                 * Copy every variable that is not listed from the old to the new state. Adjacent unchanged variables are
+                 * coalesced into a single ``memcpy``.
+                 *
+                 * \param Changed: The state variable tag types that are updated by the material model and not copied
+                 * \param *state_new: The pointer to the start of the column major ``stateNew`` array
+                 * \param *state_old: The pointer to the start of the column major ``stateOld`` array
+                 * \param &nblock: The number of material points in the block
+                 */
+                static_assert( ( contains< Changed > && ... ), "The state variable is not part of the layout" );
+                int start = 0;
+                int end = 0;
+                auto flush = [ & ]( ){
+                    if ( end > start ){
+                        memcpy( state_new + start * nblock, state_old + start * nblock, sizeof( T ) * nblock * ( end - start ) );
+                    }
+                };
+                ( ( isListed< Variables, Changed... > ? ( flush( ), start = end + Variables::components ) : 0,
+                    end += Variables::components ), ... );
+                flush( );
+            }
+
+        private:
+
+            template< class Variable, class... List >
+            static constexpr bool isListed = ( std::is_same_v< Variable, List > || ... );
+
+    };
+
+    template< class Layout, typename T = double >
+    class StateVariables{
+        /*!
+         * Zero-copy named access to the Abaqus ``STATEV`` array or a column major VUMAT ``stateOld( nblock, nstatev )`` or
+         * ``stateNew( nblock, nstatev )`` array described by a ``StateVariableLayout``.
+         *
+         * \param Layout: The ``StateVariableLayout`` of the array
+         * \param T: The scalar type. Use a ``const`` type for ``stateOld``.
+         */
+
+        public:
+
+            StateVariables( T *state, const int &nblock = 1, const int &nstatev = Layout::size ) :
+                _data( state ), _nblock( nblock ){
+                /*!
+                 * \param *state: The pointer to the start of the column major state variable array
+                 * \param &nblock: The number of material points in the block. One for the UMAT ``STATEV`` array.
+                 * \param &nstatev: The number of state variables of the array, e.g. ``NSTATV``
+                 */
+                if constexpr ( checkSizes ){
+                    if ( nstatev < Layout::size ){
+                        throw std::length_error( "The number of state variables must be at least the layout size" );
+                    }
+                }
+            }
+
+            template< class Variable >
+            T &get( const int &k = 0, const int &component = 0 ) const{
+                /*!
+                 * \param Variable: The state variable tag type
+                 * \param &k: The material point index in the block
+                 * \param &component: The component of the variable
+                 * \returns A reference to the state variable component
+                 */
+                return _data[ ( Layout::template offset< Variable >( ) + component ) * _nblock + k ];
+            }
+
+            template< class Variable >
+            ColumnMajorView< T > view( ) const{
+                /*!
+                 * \param Variable: The state variable tag type
+                 * \returns A nblock by components column major view of the variable
+                 */
+                return ColumnMajorView< T >( _data + Layout::template offset< Variable >( ) * _nblock, _nblock,
+                                             Layout::template components< Variable >( ) );
+            }
+
+            T *data( ) const{
+                /*!
+                 * \returns The pointer to the start of the state variable array
+                 */
+                return _data;
+            }
+
+            int nblock( ) const{
+                /*!
+                 * \returns nblock: The number of material points in the block
+                 */
+                return _nblock;
+            }
+
+        private:
+
+            T *_data;
+
+            int _nblock;
+
+    };
+
+    //! Converter families reported by the instrumentation counters
+    enum class Converter : unsigned int{
+        columnToRowMajor,
+        rowToColumnMajor,
+        expandAbaqusNTENSVector,
+        contractAbaqusNTENSVector,
+        expandAbaqusNTENSMatrix,
+        contractAbaqusNTENSMatrix,
+        expandFullNTENSTensor,
+        contractFullNTENSTensor,
+        expandFullNTENSMatrix,
+        contractFullNTENSMatrix,
+        expandFullNTENSTensorBlock,
+        contractFullNTENSTensorBlock,
+        expandFullNTENSTensorBatch,
+        contractFullNTENSTensorBatch,
+        convertPrecision,
+        rotateNTENSVector,
+        rotateNTENSBlock
+    };
+
+    //! Number of instrumented converter families
+    constexpr std::size_t converterCount = 17;
+
+    //! Reported name of each instrumented converter family
+    constexpr std::array< const char*, converterCount > converterNames = {
+        "columnToRowMajor", "rowToColumnMajor", "expandAbaqusNTENSVector", "contractAbaqusNTENSVector",
+        "expandAbaqusNTENSMatrix", "contractAbaqusNTENSMatrix", "expandFullNTENSTensor", "contractFullNTENSTensor",
+        "expandFullNTENSMatrix", "contractFullNTENSMatrix", "expandFullNTENSTensorBlock", "contractFullNTENSTensorBlock",
+        "expandFullNTENSTensorBatch", "contractFullNTENSTensorBatch", "convertPrecision", "rotateNTENSVector",
+        "rotateNTENSBlock"
+    };
+
+#ifdef TARDIGRADE_ABAQUS_TOOLS_X86_SIMD
+    //! Unit of the instrumentation ``cycles`` counter
+    constexpr const char *cycleCounterUnit = "tsc";
+#else
+    //! Unit of the instrumentation ``cycles`` counter
+    constexpr const char *cycleCounterUnit = "ns";
+#endif
+
+    inline unsigned long long readCycleCounter( ){
+        /*!
+         * Read the time stamp counter on x86 processors and a monotonic nanosecond clock otherwise. See
+         * ``cycleCounterUnit``.
+         *
+         * \returns The current counter value
+         */
+#ifdef TARDIGRADE_ABAQUS_TOOLS_X86_SIMD
+        return __rdtsc( );
+#else
+        return std::chrono::duration_cast< std::chrono::nanoseconds >(
+                   std::chrono::steady_clock::now( ).time_since_epoch( ) ).count( );
+#endif
+    }
+
+    //! Number of instrumented calls per timed call on each thread
+    constexpr unsigned int instrumentationSamplePeriod = TARDIGRADE_ABAQUS_TOOLS_INSTRUMENTATION_SAMPLE_PERIOD;
+
+    //! Calls, bytes moved, and elapsed cycles of the timed calls of a converter family
+    struct InstrumentationRecord{
+        unsigned long long calls = 0;
+        unsigned long long bytes = 0;
+        unsigned long long timed_calls = 0;
+        unsigned long long cycles = 0;
+    };
+
+    //! Instrumentation records of every converter family
+    using InstrumentationRecords = std::array< InstrumentationRecord, converterCount >;
+
+    class ThreadInstrumentation;
+
+    class InstrumentationRegistry{
+        /*!
+         * Process wide merge point of the per-thread instrumentation counters. The registry lock is only taken when a
+         * thread starts or exits and when the counters are reported, never in the converters.
+         *
+         * When the ``TARDIGRADE_ABAQUS_TOOLS_INSTRUMENTATION_FILE`` environment variable is set and instrumentation is
+         * compiled in, the merged counters are written to that file at program exit, see ``writeInstrumentation``.
+         */
+
+        public:
+
+            static InstrumentationRegistry &instance( ){
+                /*!
+                 * \returns The process wide registry
+                 */
+                static InstrumentationRegistry registry;
+                return registry;
+            }
+
+            ~InstrumentationRegistry( );
+
+            void attach( ThreadInstrumentation *thread_counters ){
+                /*!
+                 * Register the counters of a new thread
+                 *
+                 * \param *thread_counters: The thread's counters
+                 */
+                std::lock_guard< std::mutex > lock( _mutex );
+                _threads.push_back( thread_counters );
+            }
+
+            void detach( ThreadInstrumentation *thread_counters );
+
+            InstrumentationRecords totals( );
+
+            void reset( );
+
+        private:
+
+            InstrumentationRegistry( ) = default;
+
+            std::mutex _mutex;
+
+            std::vector< ThreadInstrumentation* > _threads;
+
+            InstrumentationRecords _merged = { };
+
+    };
+
+    class ThreadInstrumentation{
+        /*!
+         * Counters of the converters called by a single thread. Only the owning thread writes the counters, so they are
+         * updated with relaxed atomic loads and stores instead of locked read-modify-write instructions. The counters are
+         * merged into the ``InstrumentationRegistry`` when the thread exits.
+         */
+
+        public:
+
+            ThreadInstrumentation( ){
+                InstrumentationRegistry::instance( ).attach( this );
+            }
+
+            ~ThreadInstrumentation( ){
+                InstrumentationRegistry::instance( ).detach( this );
+            }
+
+            ThreadInstrumentation( const ThreadInstrumentation & ) = delete;
+
+            ThreadInstrumentation &operator=( const ThreadInstrumentation & ) = delete;
+
+            void add( const Converter &converter, const unsigned long long &bytes ){
+                /*!
+                 * Count a converter call
+                 *
+                 * \param &converter: The converter family
+                 * \param &bytes: The number of bytes read and written by the call
+                 */
+                Counters &counters = _counters[ static_cast< std::size_t >( converter ) ];
+                increment( counters.calls, 1 );
+                increment( counters.bytes, bytes );
+            }
+
+            void addTimed( const Converter &converter, const unsigned long long &cycles ){
+                /*!
+                 * Count the elapsed cycles of a timed converter call
+                 *
+                 * \param &converter: The converter family
+                 * \param &cycles: The elapsed cycles of the call
+                 */
+                Counters &counters = _counters[ static_cast< std::size_t >( converter ) ];
+                increment( counters.timed_calls, 1 );
+                increment( counters.cycles, cycles );
+            }
+
+            bool sample( ){
+                /*!
+                 * \returns True once every ``instrumentationSamplePeriod`` calls
+                 */
+                if ( --_countdown == 0 ){
+                    _countdown = instrumentationSamplePeriod;
+                    return true;
+                }
+                return false;
+            }
+
+            void accumulate( InstrumentationRecords &records ) const{
+                /*!
+                 * Add the counters of this thread to a set of records
+                 *
+                 * \param &records: The records to add to
+                 */
+                for ( std::size_t index = 0; index < converterCount; index++ ){
+                    records[ index ].calls += _counters[ index ].calls.load( std::memory_order_relaxed );
+                    records[ index ].bytes += _counters[ index ].bytes.load( std::memory_order_relaxed );
+                    records[ index ].timed_calls += _counters[ index ].timed_calls.load( std::memory_order_relaxed );
+                    records[ index ].cycles += _counters[ index ].cycles.load( std::memory_order_relaxed );
+                }
+            }
+
+            void reset( ){
+                /*!
+                 * Zero the counters of this thread
+                 */
+                for ( Counters &counters : _counters ){
+                    counters.calls.store( 0, std::memory_order_relaxed );
+                    counters.bytes.store( 0, std::memory_order_relaxed );
+                    counters.timed_calls.store( 0, std::memory_order_relaxed );
+                    counters.cycles.store( 0, std::memory_order_relaxed );
+                }
+            }
+
+            //! Nesting depth of the instrumented calls on this thread. Only the outermost converter call is counted.
+            int depth = 0;
+
+        private:
+
+            struct Counters{
+                std::atomic< unsigned long long > calls{ 0 };
+                std::atomic< unsigned long long > bytes{ 0 };
+                std::atomic< unsigned long long > timed_calls{ 0 };
+                std::atomic< unsigned long long > cycles{ 0 };
+            };
+
+            static void increment( std::atomic< unsigned long long > &counter, const unsigned long long &value ){
+                counter.store( counter.load( std::memory_order_relaxed ) + value, std::memory_order_relaxed );
+            }
+
+            std::array< Counters, converterCount > _counters;
+
+            unsigned int _countdown = 1;
+
+    };
+
+    inline void InstrumentationRegistry::detach( ThreadInstrumentation *thread_counters ){
+        /*!
+         * Merge the counters of an exiting thread and unregister them
+         *
+         * \param *thread_counters: The thread's counters
+         */
+        std::lock_guard< std::mutex > lock( _mutex );
+        thread_counters->accumulate( _merged );
+        _threads.erase( std::remove( _threads.begin( ), _threads.end( ), thread_counters ), _threads.end( ) );
+    }
+
+    inline InstrumentationRecords InstrumentationRegistry::totals( ){
+        /*!
+         * \returns The counters of the exited threads plus the current counters of the running threads
+         */
+        std::lock_guard< std::mutex > lock( _mutex );
+        InstrumentationRecords records = _merged;
+        for ( const ThreadInstrumentation *thread_counters : _threads ){
+            thread_counters->accumulate( records );
+        }
+        return records;
+    }
+
+    inline void InstrumentationRegistry::reset( ){
+        /*!
+         * Zero the merged counters and the counters of the running threads. Call between analyses when no converters
+         * are running.
+         */
+        std::lock_guard< std::mutex > lock( _mutex );
+        _merged = { };
+        for ( ThreadInstrumentation *thread_counters : _threads ){
+            thread_counters->reset( );
+        }
+    }
+
+    inline ThreadInstrumentation &threadInstrumentation( ){
+        /*!
+         * \returns The calling thread's converter counters
+         */
+        thread_local ThreadInstrumentation counters;
+        return counters;
+    }
+
+    class ScopedInstrumentation{
+        /*!
+         * Count the calls, bytes moved, and elapsed cycles of a converter from construction to destruction. Nested
+         * converter calls, e.g. overloads forwarding to each other, are only counted once by the outermost scope. Only
+         * one of every ``instrumentationSamplePeriod`` counted calls is timed.
+         *
+         * The converters create a scope with the ``TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT`` macro, which is empty unless
+         * ``TARDIGRADE_ABAQUS_TOOLS_INSTRUMENTATION`` is 1.
+         */
+
+        public:
+
+            ScopedInstrumentation( const Converter &converter, const std::size_t &bytes ) :
+                _counters( threadInstrumentation( ) ), _converter( converter ), _bytes( bytes ),
+                _outermost( _counters.depth++ == 0 ), _timed( _outermost && _counters.sample( ) ),
+                _start( _timed ? readCycleCounter( ) : 0 ){
+                /*!
+                 * \param &converter: The converter family
+                 * \param &bytes: The number of bytes read and written by the converter
+                 */
+            }
+
+            ~ScopedInstrumentation( ){
+                _counters.depth--;
+                if ( _timed ){
+                    _counters.addTimed( _converter, readCycleCounter( ) - _start );
+                }
+                if ( _outermost ){
+                    _counters.add( _converter, _bytes );
+                }
+            }
+
+            ScopedInstrumentation( const ScopedInstrumentation & ) = delete;
+
+            ScopedInstrumentation &operator=( const ScopedInstrumentation & ) = delete;
+
+        private:
+
+            ThreadInstrumentation &_counters;
+
+            Converter _converter;
+
+            std::size_t _bytes;
+
+            bool _outermost;
+
+            bool _timed;
+
+            unsigned long long _start;
+
+    };
+
+    inline void writeInstrumentationCSV( std::ostream &stream, const InstrumentationRecords &records ){
+        /*!
+         * Write the instrumentation records as CSV with one row per converter family
+         *
+         * \param &stream: The output stream
+         * \param &records: The records, e.g. from ``InstrumentationRegistry::instance( ).totals( )``
+         */
+        stream << "converter,calls,bytes,timed_calls," << cycleCounterUnit << "\n";
+        for ( std::size_t index = 0; index < converterCount; index++ ){
+            stream << converterNames[ index ] << "," << records[ index ].calls << "," << records[ index ].bytes << ","
+                   << records[ index ].timed_calls << "," << records[ index ].cycles << "\n";
+        }
+    }
+
+    inline void writeInstrumentationJSON( std::ostream &stream, const InstrumentationRecords &records ){
+        /*!
+         * Write the instrumentation records as a JSON object keyed by converter family
+         *
+         * \param &stream: The output stream
+         * \param &records: The records, e.g. from ``InstrumentationRegistry::instance( ).totals( )``
+         */
+        stream << "{\n  \"cycle_unit\": \"" << cycleCounterUnit << "\",\n  \"converters\": {";
+        for ( std::size_t index = 0; index < converterCount; index++ ){
+            stream << ( index == 0 ? "\n" : ",\n" )
+                   << "    \"" << converterNames[ index ] << "\": { \"calls\": " << records[ index ].calls
+                   << ", \"bytes\": " << records[ index ].bytes << ", \"timed_calls\": " << records[ index ].timed_calls
+                   << ", \"cycles\": " << records[ index ].cycles << " }";
+        }
+        stream << "\n  }\n}\n";
+    }
+
+    inline void writeInstrumentation( const std::string &filename ){
+        /*!
+         * Write the merged instrumentation counters of all threads to a file. Files ending in ``.json`` are written as
+         * JSON and all others as CSV.
+         *
+         * \param &filename: The output file name
+         */
+        std::ofstream file( filename );
+        if ( !file ){
+            throw std::runtime_error( "Could not open the instrumentation file " + filename );
+        }
+        const InstrumentationRecords records = InstrumentationRegistry::instance( ).totals( );
+        const std::string extension = ".json";
+        if ( filename.size( ) >= extension.size( ) &&
+             filename.compare( filename.size( ) - extension.size( ), extension.size( ), extension ) == 0 ){
+            writeInstrumentationJSON( file, records );
+        }
+        else{
+            writeInstrumentationCSV( file, records );
+        }
+    }
+
+    inline InstrumentationRegistry::~InstrumentationRegistry( ){
+#if TARDIGRADE_ABAQUS_TOOLS_INSTRUMENTATION
+        const char *filename = std::getenv( "TARDIGRADE_ABAQUS_TOOLS_INSTRUMENTATION_FILE" );
+        if ( filename != nullptr ){
+            try{
+                writeInstrumentation( filename );
+            }
+            catch ( const std::exception &error ){
+                std::cerr << error.what( ) << "\n";
+            }
+        }
+#endif
+    }
+
+    template< class Function >
+    inline void blockedTranspose( const int &height, const int &width, Function &&copy ){
+        /*!
+         * Visit every entry of a height by width array for a row and column major conversion. Arrays with more than
+         * ``tardigradeAbaqusTools::blockedTransposeThreshold`` entries are visited in square tiles of
+         * ``tardigradeAbaqusTools::transposeBlockSize`` so that the strided accesses stay in cache.
+         *
+         * \param &height: The height of the array, e.g. number of rows
+         * \param &width: The width of the array, e.g. number of columns
+         * \param &&copy: The callable copying one entry, called as ``copy( row, col )``
+         */
+        if ( std::size_t( height ) * width <= std::size_t( blockedTransposeThreshold ) ){
+            for ( int row = 0; row < height; row++ ){
+                for ( int col = 0; col < width; col++ ){
+                    copy( row, col );
+                }
+            }
+            return;
+        }
+
+        for ( int row_block = 0; row_block < height; row_block += transposeBlockSize ){
+            const int row_end = std::min( row_block + transposeBlockSize, height );
+            for ( int col_block = 0; col_block < width; col_block += transposeBlockSize ){
+                const int col_end = std::min( col_block + transposeBlockSize, width );
+                for ( int col = col_block; col < col_end; col++ ){
+                    for ( int row = row_block; row < row_end; row++ ){
+                        copy( row, col );
+                    }
+                }
+            }
+        }
+    }
+
+    template< typename T, class RowMajor, typename = EnableIfMatrixOutput< RowMajor, VectorOfVectors< T > > >
+    inline void columnToRowMajor( const T *column_major, RowMajor &&row_major, const int &height, const int &width ){
+        /*!
+         * Convert column major two dimensional arrays to a preallocated row major two dimensional array.
+         *
+         * \param *column_major: The pointer to the start of a column major array
+         * \param &&row_major: The destination row major array, e.g. a vector of vectors. At least height by width.
+         * \param &height: The height of the array, e.g. number of rows
+         * \param &width: The width of the array, e.g. number of columns
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( columnToRowMajor, 2 * std::size_t( height ) * width * sizeof( T ) );
+        checkSize( row_major, height, width, "Row major size must match column major size" );
+        blockedTranspose( height, width, [ & ]( const int &row, const int &col ){
+            matrixEntry( row_major, row, col ) = column_major[ std::size_t( col ) * height + row ];
+        } );
+    }
+
+    template< typename T, class Allocator = std::allocator< T >, typename = EnableIfAllocator< Allocator, T > >
+    inline VectorOfVectors< T, Allocator > columnToRowMajor( const T *column_major,  const int &height, const int &width,
+                                                             const Allocator &allocator = Allocator( ) ){
+        /*!
+         * Convert column major two dimensional arrays to row major.
+         *
+         * Specifically, convert pointers to Fortran column major arrays to c++ row major vector of vectors.
+         *
+         * \param *column_major: The pointer to the start of a column major array
+         * \param &height: The height of the array, e.g. number of rows
+         * \param &width: The width of the array, e.g. number of columns
+         * \param &allocator: The allocator for the rows and the outer vector, e.g. an ``ArenaAllocator``. Default:
+         *     ``std::allocator``.
+         * \return row_major: A c++ row major vector of vectors
+         */
+
+        VectorOfVectors< T, Allocator > row_major( height, std::vector< T, Allocator >( width, allocator ), allocator );
+        columnToRowMajor( column_major, row_major, height, width );
+        return row_major;
+    }
+
+    template< typename T, typename U >
+    inline void rowToColumnMajor( T *column_major, const U *row_major, const int &height, const int &width ){
+        /*!
+         * Convert a row major two dimensional array to a column major array without allocating memory.
+         *
+         * Arrays with more than ``tardigradeAbaqusTools::blockedTransposeThreshold`` entries are converted in square
+         * tiles of ``tardigradeAbaqusTools::transposeBlockSize`` so that the strided column major writes stay in cache.
+         * The source entries are converted to the destination scalar type in the same pass.
+         *
+         * \param *column_major: The pointer to the start of the destination column major array
+         * \param *row_major: The pointer to the start of the source row major array
+         * \param &height: The height of the array, e.g. number of rows
+         * \param &width: The width of the array, e.g. number of columns
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( rowToColumnMajor, std::size_t( height ) * width * ( sizeof( T ) + sizeof( U ) ) );
+        blockedTranspose( height, width, [ & ]( const int &row, const int &col ){
+            column_major[ std::size_t( col ) * height + row ] = static_cast< T >( row_major[ std::size_t( row ) * width + col ] );
+        } );
+    }
+
+    template< typename T, typename U >
+    inline void columnToRowMajor( const T *column_major, U *row_major, const int &height, const int &width ){
+        /*!
+         * Convert a column major two dimensional array to a row major array without allocating memory.
+         *
+         * Uses the same blocked transpose as the row to column major conversion for large arrays.
+         *
+         * \param *column_major: The pointer to the start of the source column major array
+         * \param *row_major: The pointer to the start of the destination row major array
+         * \param &height: The height of the array, e.g. number of rows
+         * \param &width: The width of the array, e.g. number of columns
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( columnToRowMajor, std::size_t( height ) * width * ( sizeof( T ) + sizeof( U ) ) );
+
+        //A column major height x width array is a row major width x height array
+        rowToColumnMajor( row_major, column_major, width, height );
+    }
+
+    template< typename T >
+    inline void transposeInPlace( T *array, const int &size ){
+        /*!
+         * Convert a square array between row and column major storage in place. Large arrays are transposed in square
+         * tiles of ``tardigradeAbaqusTools::transposeBlockSize``.
+         *
+         * \param *array: The pointer to the start of the square array
+         * \param &size: The number of rows and columns
+         */
+        for ( int row_block = 0; row_block < size; row_block += transposeBlockSize ){
+            const int row_end = std::min( row_block + transposeBlockSize, size );
+            for ( int col_block = row_block; col_block < size; col_block += transposeBlockSize ){
+                const int col_end = std::min( col_block + transposeBlockSize, size );
+                for ( int row = row_block; row < row_end; row++ ){
+                    for ( int col = std::max( col_block, row + 1 ); col < col_end; col++ ){
+                        std::swap( array[ std::size_t( row ) * size + col ], array[ std::size_t( col ) * size + row ] );
+                    }
+                }
+            }
+        }
+    }
+
+    template< typename T, typename U, class Allocator >
+    inline void rowToColumnMajor( T *column_major, const VectorOfVectors< U, Allocator > &row_major_array,
+                                  const int &height, const int &width ){
+        /*!
+         * Convert row major two dimensional arrays to column major
+         *
+         * Specifically, c++ row major vector of vectors or arrays to Fortran column major arrays using the column major
+         * pointer. The scalar types may differ, e.g. double precision results written to a single precision Fortran
+         * array.
+         *
+         * \param *column_major: The pointer to the start of a column major array
+         * \param &row_major_array: A c++ two dimensional, row major vector of vectors
+         * \param &height: The height of the array, e.g. number of rows
+         * \param &width: The width of the array, e.g. number of columns
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( rowToColumnMajor, std::size_t( height ) * width * ( sizeof( T ) + sizeof( U ) ) );
+        if ( checkSizes ){
+            const int rows = row_major_array.size();
+            const int columns = row_major_array[0].size();
+            if (rows != height || columns != width){
+                throw std::length_error("Column major size must match row major size");
+            }
+        }
+        blockedTranspose( height, width, [ & ]( const int &row, const int &col ){
+            column_major[ std::size_t( col ) * height + row ] = static_cast< T >( row_major_array[ row ][ col ] );
+        } );
+
+        return;
+    }
+
+    template< typename T, typename U, class Allocator, typename = EnableIfAllocator< Allocator, U > >
+    inline void rowToColumnMajor( T *column_major, const std::vector< U, Allocator > &row_major, const int &height, const int &width ){
+        /*!
+         * Convert row major two dimensional arrays stored as vector to column major array
+         *
+         * Specifically, c++ row major vector to Fortran column major arrays using the column major pointer.
+         *
+         * \param *column_major: The pointer to the start of a column major array
+         * \param &row_major_array: A c++ two dimensional array stored as row major vector
+         * \param &height: The height of the array, e.g. number of rows. The c++ row count (1) for 1D arrays.
+         * \param &width: The width of the array, e.g. number of columns. The c++ column count (size) for 1D arrays.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( rowToColumnMajor, std::size_t( height ) * width * ( sizeof( T ) + sizeof( U ) ) );
+        if ( checkSizes && ( row_major.size( ) != std::size_t( height ) * width ) ){
+            throw std::length_error("Column major size must match row major size");
+        }
+        rowToColumnMajor( column_major, row_major.data( ), height, width );
+    }
+
+    template< typename T, int HEIGHT, int WIDTH, class Allocator = std::allocator< std::remove_const_t< T > >,
+              typename = EnableIfAllocator< Allocator, std::remove_const_t< T > > >
+    inline VectorOfVectors< std::remove_const_t< T >, Allocator > columnToRowMajor( const ColumnMajorView< T, HEIGHT, WIDTH > &column_major,
+                                                                                   const Allocator &allocator = Allocator( ) ){
+        /*!
+         * Convert a column major array view to a row major vector of vectors.
+         *
+         * \param &column_major: The view of a column major array
+         * \param &allocator: The allocator for the rows and the outer vector. Default: ``std::allocator``.
+         * \return row_major: A c++ row major vector of vectors
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( columnToRowMajor, 2 * column_major.size( ) * sizeof( T ) );
+        return columnToRowMajor( static_cast< const std::remove_const_t< T >* >( column_major.data( ) ),
+                                 column_major.height( ), column_major.width( ), allocator );
+    }
+
+    template< typename T, int HEIGHT, int WIDTH, typename U, int ROW_HEIGHT, int ROW_WIDTH >
+    inline void columnToRowMajor( const ColumnMajorView< T, HEIGHT, WIDTH > &column_major,
+                                  const RowMajorView< U, ROW_HEIGHT, ROW_WIDTH > &row_major ){
+        /*!
+         * Copy a column major array view into a row major array view without allocating memory.
+         *
+         * \param &column_major: The view of the source column major array
+         * \param &row_major: The view of the destination row major array
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( columnToRowMajor, column_major.size( ) * ( sizeof( T ) + sizeof( U ) ) );
+        if ( checkSizes && ( row_major.height( ) != column_major.height( ) || row_major.width( ) != column_major.width( ) ) ){
+            throw std::length_error( "Column major size must match row major size" );
+        }
+        columnToRowMajor( column_major.data( ), row_major.data( ), column_major.height( ), column_major.width( ) );
+    }
+
+    template< typename T, int HEIGHT, int WIDTH, typename U, int ROW_HEIGHT, int ROW_WIDTH >
+    inline void rowToColumnMajor( const ColumnMajorView< T, HEIGHT, WIDTH > &column_major,
+                                  const RowMajorView< U, ROW_HEIGHT, ROW_WIDTH > &row_major ){
+        /*!
+         * Copy a row major array view into a column major array view without allocating memory.
+         *
+         * \param &column_major: The view of the destination column major array
+         * \param &row_major: The view of the source row major array
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( rowToColumnMajor, column_major.size( ) * ( sizeof( T ) + sizeof( U ) ) );
+        if ( checkSizes && ( row_major.height( ) != column_major.height( ) || row_major.width( ) != column_major.width( ) ) ){
+            throw std::length_error( "Column major size must match row major size" );
+        }
+        rowToColumnMajor( column_major.data( ), row_major.data( ), column_major.height( ), column_major.width( ) );
+    }
+
+    template< typename T, int HEIGHT, int WIDTH, class Allocator >
+    inline void rowToColumnMajor( const ColumnMajorView< T, HEIGHT, WIDTH > &column_major,
+                                  const VectorOfVectors< std::remove_const_t< T >, Allocator > &row_major_array ){
+        /*!
+         * Convert a row major vector of vectors to a column major array view
+         *
+         * \param &column_major: The view of the destination column major array
+         * \param &row_major_array: A c++ two dimensional, row major vector of vectors
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( rowToColumnMajor, 2 * column_major.size( ) * sizeof( T ) );
+        rowToColumnMajor( column_major.data( ), row_major_array, column_major.height( ), column_major.width( ) );
+    }
+
+    template< typename T, int HEIGHT, int WIDTH, class Allocator, typename = EnableIfAllocator< Allocator, std::remove_const_t< T > > >
+    inline void rowToColumnMajor( const ColumnMajorView< T, HEIGHT, WIDTH > &column_major,
+                                  const std::vector< std::remove_const_t< T >, Allocator > &row_major ){
+        /*!
+         * Convert a row major two dimensional array stored as vector to a column major array view
+         *
+         * \param &column_major: The view of the destination column major array
+         * \param &row_major: A c++ two dimensional array stored as row major vector
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( rowToColumnMajor, 2 * column_major.size( ) * sizeof( T ) );
+        rowToColumnMajor( column_major.data( ), row_major, column_major.height( ), column_major.width( ) );
+    }
+
+    template< typename T, class Allocator >
+    inline std::vector< T, Allocator > expandAbaqusNTENSVector( const std::vector< T, Allocator > &abaqus_vector,
+                                                                const int &NDI, const int &NSHR ){
+        /*!
+         * Expand stress and strain type components to full Abaqus vectors.
+         *
+         * See the Abaqus documentation > Introduction & Spatial Modeling > Conventions chapter > Convention used for stress
+         * and strain components.
+         *
+         * The stress vector components for Abaqus/Standard (UMAT) are
+         *
+         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{13}, \tau_{23} \right ) \f$
+         *
+         * and the strain vector components match as
+         *
+         * \f$ \left ( \epsilon_{11}, \epsilon_{22}, \epsilon_{33}, \gamma_{12}, \gamma_{13}, \gamma_{23} \right ) \f$
+         *
+         * The stress vector components for Abaqus/Explicit (VUMAT) are
+         *
+         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{23}, \tau_{13} \right ) \f$
+         *
+         * and the strain vector components match as
+         *
+         * \f$ \left ( \epsilon_{11}, \epsilon_{22}, \epsilon_{33}, \gamma_{12}, \gamma_{23}, \gamma_{13} \right ) \f$
+         *
+         * where components that are zero-valued by definition, e.g. plane stress, are omitted. The shear strain is the
+         * engineering shear strain where
+         *
+         * \f$ \gamma_{ij} = \epsilon_{ij} + \epsilon_{ji} \f$
+         *
+         * for both Abaqus/Standard and Abaqus/Explicit.
+         *
+         * \param &abaqus_vector: an abaqus stress-type vector with no by-definition-zero components. Length NDI + NSHR.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \returns vector_expansion: c++ type vector of length 6.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandAbaqusNTENSVector, ( NDI + NSHR + 6 ) * sizeof( T ) );
+
+        checkNTENS( NDI, NSHR );
+        checkSize( abaqus_vector, NDI + NSHR, "The abaqus vector must have NDI + NSHR entries" );
+
+        //Initialize expanded vector to the appropriate dimensions with zero values
+        std::vector< T, Allocator > vector_expansion( 6, 0, abaqus_vector.get_allocator( ) );
+
+        //Unpack direct components of Abaqus/Standard stress-type vector
+        for ( int index = 0; index < NDI; index++ ){
+            vector_expansion[ index ] = abaqus_vector[ index ];
+        }
+
+        //Unpack shear components of Abaqus/Standard stress-type vector
+        for ( int index = 0; index < NSHR; index++ ){
+            vector_expansion[ 3 + index ] = abaqus_vector[ NDI + index ];
+        }
+
+        return vector_expansion;
+    }
+
+    template< class Output, class Vector, typename = EnableIfVectorOutput< Output, Vector > >
+    inline void expandAbaqusNTENSVector( Output &&vector_expansion, const Vector &abaqus_vector,
+                                         const int &NDI, const int &NSHR ){
+        /*!
+         * Expand stress and strain type components into a preallocated full Abaqus vector.
+         *
+         * See the ``std::vector`` overload for the Abaqus component ordering.
+         *
+         * \param &&vector_expansion: The destination vector, e.g. ``std::vector``, ``std::array``, or ``ColumnMajorView``.
+         *     Length 6.
+         * \param &abaqus_vector: an abaqus stress-type vector with no by-definition-zero components. Length NDI + NSHR.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandAbaqusNTENSVector,
+                                            ( NDI + NSHR + 6 ) * sizeof( ScalarType< Vector > ) );
+
+        checkNTENS( NDI, NSHR );
+        checkSize( vector_expansion, 6, "The expanded vector must have 6 entries" );
+        checkSize( abaqus_vector, NDI + NSHR, "The abaqus vector must have NDI + NSHR entries" );
+
+        for ( int index = 0; index < 6; index++ ){
+            const int abaqus_index = contractedIndex( index, NDI, NSHR );
+            vector_expansion[ index ] = abaqus_index < 0 ? ScalarType< Vector >( 0 ) : abaqus_vector[ abaqus_index ];
+        }
+    }
+
+    template< typename T, std::size_t N >
+    inline std::array< T, 6 > expandAbaqusNTENSVector( const std::array< T, N > &abaqus_vector,
+                                                       const int &NDI, const int &NSHR ){
+        /*!
+         * Expand stress and strain type components to full Abaqus vectors without heap allocation.
+         *
+         * See the ``std::vector`` overload for the Abaqus component ordering.
+         *
+         * \param &abaqus_vector: an abaqus stress-type vector with no by-definition-zero components stored in the
+         *     leading NDI + NSHR entries.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \returns vector_expansion: c++ type array of length 6.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandAbaqusNTENSVector, ( NDI + NSHR + 6 ) * sizeof( T ) );
+
+        checkNTENS( NDI, NSHR );
+        checkSize( abaqus_vector, NDI + NSHR, "The abaqus vector must have NDI + NSHR entries" );
+
+        //Initialize expanded vector with zero values
+        std::array< T, 6 > vector_expansion = { };
+
+        //Unpack direct components of Abaqus/Standard stress-type vector
+        for ( int index = 0; index < NDI; index++ ){
+            vector_expansion[ index ] = abaqus_vector[ index ];
+        }
+
+        //Unpack shear components of Abaqus/Standard stress-type vector
+        for ( int index = 0; index < NSHR; index++ ){
+            vector_expansion[ 3 + index ] = abaqus_vector[ NDI + index ];
+        }
+
+        return vector_expansion;
+    }
+
+    template< typename T, int HEIGHT, int WIDTH, class Allocator = std::allocator< std::remove_const_t< T > >,
+              typename = EnableIfAllocator< Allocator, std::remove_const_t< T > > >
+    inline std::vector< std::remove_const_t< T >, Allocator > expandAbaqusNTENSVector( const ColumnMajorView< T, HEIGHT, WIDTH > &abaqus_vector,
+                                                                                     const int &NDI, const int &NSHR,
+                                                                                     const Allocator &allocator = Allocator( ) ){
+        /*!
+         * Expand stress and strain type components to full Abaqus vectors directly from the Abaqus memory, e.g. the
+         * ``STRESS`` or ``STRAN`` pointers, without an intermediate copy.
+         *
+         * See the ``std::vector`` overload for the Abaqus component ordering.
+         *
+         * \param &abaqus_vector: a view of an abaqus stress-type vector with no by-definition-zero components. Size
+         *     NDI + NSHR.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param &allocator: The allocator of the returned vector. Default: ``std::allocator``.
+         * \returns vector_expansion: c++ type vector of length 6.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandAbaqusNTENSVector, ( NDI + NSHR + 6 ) * sizeof( T ) );
+
+        checkNTENS( NDI, NSHR );
+        checkSize( abaqus_vector, NDI + NSHR, "The abaqus vector must have NDI + NSHR entries" );
+
+        //Initialize expanded vector to the appropriate dimensions with zero values
+        std::vector< std::remove_const_t< T >, Allocator > vector_expansion( 6, 0, allocator );
+
+        //Unpack direct components of Abaqus/Standard stress-type vector
+        for ( int index = 0; index < NDI; index++ ){
+            vector_expansion[ index ] = abaqus_vector[ index ];
+        }
+
+        //Unpack shear components of Abaqus/Standard stress-type vector
+        for ( int index = 0; index < NSHR; index++ ){
+            vector_expansion[ 3 + index ] = abaqus_vector[ NDI + index ];
+        }
+
+        return vector_expansion;
+    }
+
+    template< typename T, class Allocator >
+    inline std::vector< T, Allocator > contractAbaqusNTENSVector( const std::vector< T, Allocator > &full_abaqus_vector,
+                                                                  const int &NDI, const int &NSHR ){
+        /*!
+         * Contract stress and strain type components from full Abaqus vectors.
+         *
+         * See the Abaqus documentation > Introduction & Spatial Modeling > Conventions chapter > Convention used for stress
+         * and strain components.
+         *
+         * The stress vector components for Abaqus/Standard (UMAT) are
+         *
+         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{13}, \tau_{23} \right ) \f$
+         *
+         * and the strain vector components match as
+         *
+         * \f$ \left ( \epsilon_{11}, \epsilon_{22}, \epsilon_{33}, \gamma_{12}, \gamma_{13}, \gamma_{23} \right ) \f$
+         *
+         * The stress vector components for Abaqus/Explicit (VUMAT) are
+         *
+         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{23}, \tau_{13} \right ) \f$
+         *
+         * and the strain vector components match as
+         *
+         * \f$ \left ( \epsilon_{11}, \epsilon_{22}, \epsilon_{33}, \gamma_{12}, \gamma_{23}, \gamma_{13} \right ) \f$
+         *
+         * where components that are zero-valued by definition, e.g. plane stress, are omitted. The shear strain is the
+         * engineering shear strain where
+         *
+         * \f$ \gamma_{ij} = \epsilon_{ij} + \epsilon_{ji} \f$
+         *
+         * for both Abaqus/Standard and Abaqus/Explicit.
+         *
+         * \param &full_abaqus_vector: a previously expanded abaqus stress-type vector. Length 6.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \returns vector_contraction: c++ type vector of length NDI + NSHR.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractAbaqusNTENSVector, ( NDI + NSHR + 6 ) * sizeof( T ) );
+
+        checkNTENS( NDI, NSHR );
+        checkSize( full_abaqus_vector, 6, "The expanded vector must have 6 entries" );
+
+        //Initialize contracted vector to the appropriate dimensions
+        std::vector< T, Allocator > vector_contraction( NDI + NSHR, full_abaqus_vector.get_allocator( ) );
+
+        //Pack non-zero direct components of Abaqus/Standard stress-type vector
+        for ( int index = 0; index < NDI; index++ ){
+            vector_contraction[ index ] = full_abaqus_vector[ index ];
+        }
+
+        //Pack non-zero shear components of Abaqus/Standard stress-type vector
+        for ( int index = 0; index < NSHR; index++ ){
+            vector_contraction[ NDI + index ] = full_abaqus_vector[ 3 + index ];
+        }
+
+        return vector_contraction;
+    }
+
+    template< class Output, class Vector, typename = EnableIfVectorOutput< Output, Vector > >
+    inline void contractAbaqusNTENSVector( Output &&vector_contraction, const Vector &full_abaqus_vector,
+                                           const int &NDI, const int &NSHR ){
+        /*!
+         * Contract stress and strain type components from full Abaqus vectors into a preallocated vector.
+         *
+         * See the ``std::vector`` overload for the Abaqus component ordering.
+         *
+         * \param &&vector_contraction: The destination vector, e.g. the ``STRESS`` pointer. Length NDI + NSHR.
+         * \param &full_abaqus_vector: a previously expanded abaqus stress-type vector. Length 6.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractAbaqusNTENSVector,
+                                            ( NDI + NSHR + 6 ) * sizeof( ScalarType< Vector > ) );
+
+        checkNTENS( NDI, NSHR );
+        checkSize( vector_contraction, NDI + NSHR, "The contracted vector must have NDI + NSHR entries" );
+        checkSize( full_abaqus_vector, 6, "The expanded vector must have 6 entries" );
+
+        for ( int index = 0; index < NDI + NSHR; index++ ){
+            vector_contraction[ index ] = full_abaqus_vector[ expandedIndex( index, NDI ) ];
+        }
+    }
+
+    template< typename T >
+    inline std::array< T, 6 > contractAbaqusNTENSVector( const std::array< T, 6 > &full_abaqus_vector,
+                                                         const int &NDI, const int &NSHR ){
+        /*!
+         * Contract stress and strain type components from full Abaqus vectors without heap allocation.
+         *
+         * See the ``std::vector`` overload for the Abaqus component ordering.
+         *
+         * \param &full_abaqus_vector: a previously expanded abaqus stress-type vector. Length 6.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \returns vector_contraction: c++ type array of length 6. The contracted vector occupies the leading NDI +
+         *     NSHR entries and the trailing entries are zero.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractAbaqusNTENSVector, ( NDI + NSHR + 6 ) * sizeof( T ) );
+
+        checkNTENS( NDI, NSHR );
+
+        //Initialize contracted vector with zero values
+        std::array< T, 6 > vector_contraction = { };
+
+        //Pack non-zero direct components of Abaqus/Standard stress-type vector
+        for ( int index = 0; index < NDI; index++ ){
+            vector_contraction[ index ] = full_abaqus_vector[ index ];
+        }
+
+        //Pack non-zero shear components of Abaqus/Standard stress-type vector
+        for ( int index = 0; index < NSHR; index++ ){
+            vector_contraction[ NDI + index ] = full_abaqus_vector[ 3 + index ];
+        }
+
+        return vector_contraction;
+    }
+
+    template< typename T, class Allocator >
+    inline VectorOfVectors< T, Allocator > contractAbaqusNTENSMatrix( const VectorOfVectors< T, Allocator > &full_abaqus_matrix,
+                                                                      const int &NDI, const int &NSHR ){
+        /*!
+         * Contract NTENS type components from full Abaqus stress-type matrixes (6x6). ONLY APPLIES TO
+         * ABAQUS/STANDARD Voigt matrices, e.g. Jaumann stiffness matrix.
+         *
+         * See the Abaqus documentation > Introduction & Spatial Modeling > Conventions chapter > Convention used for stress
+         * and strain components.
+         *
+         * The stress vector components for Abaqus/Standard (UMAT) are
+         *
+         * \f$ \left ( \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{13}, \tau_{23} \right ) \f$
+         *
+         * and the strain vector components match as
+         *
+         * \f$ \left ( \epsilon_{11}, \epsilon_{22}, \epsilon_{33}, \gamma_{12}, \gamma_{13}, \gamma_{23} \right ) \f$
+         *
+         * where components that are zero-valued by definition, e.g. plane stress, are omitted. The related matrixes are
+         * therefore ordered for Abaqus/Standard (UMAT) as
+         *
+         * TODO: Update LaTeX formatting for a well aligned matrix
+         *
+         * \f$ \left ( D_{1111}, D_{1122}, D_{1133}, D_{1112}, D_{1113}, D_{1123} \right ) \f$
+         * \f$ \left ( D_{2211}, D_{2222}, D_{2233}, D_{2212}, D_{2213}, D_{2223} \right ) \f$
+         * \f$ \left ( D_{3311}, D_{3322}, D_{3333}, D_{3312}, D_{3313}, D_{3323} \right ) \f$
+         * \f$ \left ( D_{1211}, D_{1222}, D_{1233}, D_{1212}, D_{1213}, D_{1223} \right ) \f$
+         * \f$ \left ( D_{1311}, D_{1322}, D_{1333}, D_{1312}, D_{1313}, D_{1323} \right ) \f$
+         * \f$ \left ( D_{2311}, D_{2322}, D_{2333}, D_{2312}, D_{2313}, D_{2323} \right ) \f$
+         *
+         * \param &full_abaqus_matrix: a previously expanded abaqus NTENS matrix. Dimensions 6x6.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \returns matrix_contraction: c++ type vector of vectors with square shape of size NDI + NSHR.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractAbaqusNTENSMatrix,
+                                            ( 36 + ( NDI + NSHR ) * ( NDI + NSHR ) ) * sizeof( T ) );
+
+        checkNTENS( NDI, NSHR );
+        checkSize( full_abaqus_matrix, 6, 6, "The expanded matrix must be 6x6" );
+
+        //Initialize contracted matrix to the appropriate dimensions
+        VectorOfVectors< T, Allocator > matrix_contraction = allocateVectorOfVectors< T >( NDI + NSHR, NDI + NSHR,
+                                                                                           Allocator( full_abaqus_matrix.get_allocator( ) ) );
+
+        //Loop non-zero direct component rows
+        for ( int row = 0; row < NDI; row++ ){
+            //Loop non-zero direct component columns
+            for ( int col = 0; col < NDI; col++ ){
+                matrix_contraction[ row ][ col ] = full_abaqus_matrix[ row ][ col ];
+            }
+            //Loop non-zero shear component columns
+            for ( int col = 0; col < NSHR; col++ ){
+                matrix_contraction[ row ][ NDI + col ] = full_abaqus_matrix[ row ][ 3 + col ];
+            }
+        }
+
+        //Loop non-zero shear component rows
+        for ( int row = 0; row < NSHR; row++ ){
+            //Loop non-zero direct component columns
+            for ( int col = 0; col < NDI; col++ ){
                 matrix_contraction[ NDI + row ][ col ] = full_abaqus_matrix[ 3 + row ][ col ];
             }
-            //Loop non-zero shear component columns
-            for ( int col = 0; col < NSHR; col++ ){
-                matrix_contraction[ NDI + row ][ NDI + col ] = full_abaqus_matrix[ 3 + row ][ 3 + col ];
+            //Loop non-zero shear component columns
+            for ( int col = 0; col < NSHR; col++ ){
+                matrix_contraction[ NDI + row ][ NDI + col ] = full_abaqus_matrix[ 3 + row ][ 3 + col ];
+            }
+        }
+
+        return matrix_contraction;
+    }
+
+    template< class Output, class Matrix, typename = EnableIfMatrixOutput< Output, Matrix > >
+    inline void contractAbaqusNTENSMatrix( Output &&matrix_contraction, const Matrix &full_abaqus_matrix,
+                                           const int &NDI, const int &NSHR ){
+        /*!
+         * Contract NTENS type components from full Abaqus stress-type matrixes (6x6) into a preallocated NTENSxNTENS
+         * matrix.
+         *
+         * \param &&matrix_contraction: The destination matrix, e.g. a vector of vectors or a ``ColumnMajorView`` of
+         *     ``DDSDDE``. Dimensions NTENSxNTENS where NTENS = NDI + NSHR.
+         * \param &full_abaqus_matrix: a previously expanded abaqus NTENS matrix. Dimensions 6x6.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractAbaqusNTENSMatrix,
+                                            ( 36 + ( NDI + NSHR ) * ( NDI + NSHR ) ) * sizeof( MatrixScalarType< Matrix > ) );
+
+        checkNTENS( NDI, NSHR );
+        const int NTENS = NDI + NSHR;
+        checkSize( matrix_contraction, NTENS, NTENS, "The contracted matrix must be NTENSxNTENS" );
+        checkSize( full_abaqus_matrix, 6, 6, "The expanded matrix must be 6x6" );
+
+        for ( int row = 0; row < NTENS; row++ ){
+            for ( int col = 0; col < NTENS; col++ ){
+                matrixEntry( matrix_contraction, row, col ) =
+                    matrixEntry( full_abaqus_matrix, expandedIndex( row, NDI ), expandedIndex( col, NDI ) );
+            }
+        }
+    }
+
+    template< typename T, class Allocator >
+    inline VectorOfVectors< T, Allocator > expandAbaqusNTENSMatrix( const VectorOfVectors< T, Allocator > &abaqus_matrix,
+                                                                    const int &NDI, const int &NSHR ){
+        /*!
+         * Expand NTENS type components to full Abaqus stress-type matrixes (6x6). The inverse of
+         * ``contractAbaqusNTENSMatrix``. The by-definition-zero rows and columns are zero.
+         *
+         * See ``contractAbaqusNTENSMatrix`` for the matrix component ordering.
+         *
+         * \param &abaqus_matrix: a contracted abaqus NTENS matrix. Dimensions NTENSxNTENS where NTENS = NDI + NSHR.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \returns matrix_expansion: c++ type vector of vectors with dimensions 6x6.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandAbaqusNTENSMatrix,
+                                            ( 36 + ( NDI + NSHR ) * ( NDI + NSHR ) ) * sizeof( T ) );
+
+        checkNTENS( NDI, NSHR );
+        checkSize( abaqus_matrix, NDI + NSHR, NDI + NSHR, "The contracted matrix must be NTENSxNTENS" );
+
+        //Initialize expanded matrix to the appropriate dimensions with zero values
+        VectorOfVectors< T, Allocator > matrix_expansion = allocateVectorOfVectors< T >( 6, 6, Allocator( abaqus_matrix.get_allocator( ) ) );
+
+        //Unpack the non-zero rows and columns
+        for ( int row = 0; row < NDI + NSHR; row++ ){
+            for ( int col = 0; col < NDI + NSHR; col++ ){
+                matrix_expansion[ expandedIndex( row, NDI ) ][ expandedIndex( col, NDI ) ] = abaqus_matrix[ row ][ col ];
+            }
+        }
+
+        return matrix_expansion;
+    }
+
+    template< class Output, class Matrix, typename = EnableIfMatrixOutput< Output, Matrix > >
+    inline void expandAbaqusNTENSMatrix( Output &&matrix_expansion, const Matrix &abaqus_matrix,
+                                         const int &NDI, const int &NSHR ){
+        /*!
+         * Expand NTENS type components into a preallocated full Abaqus stress-type matrix (6x6). The
+         * by-definition-zero rows and columns are zero.
+         *
+         * \param &&matrix_expansion: The destination matrix. Dimensions 6x6.
+         * \param &abaqus_matrix: a contracted abaqus NTENS matrix, e.g. a ``ColumnMajorView`` of ``DDSDDE``.
+         *     Dimensions NTENSxNTENS where NTENS = NDI + NSHR.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandAbaqusNTENSMatrix,
+                                            ( 36 + ( NDI + NSHR ) * ( NDI + NSHR ) ) * sizeof( MatrixScalarType< Matrix > ) );
+
+        checkNTENS( NDI, NSHR );
+        checkSize( matrix_expansion, 6, 6, "The expanded matrix must be 6x6" );
+        checkSize( abaqus_matrix, NDI + NSHR, NDI + NSHR, "The contracted matrix must be NTENSxNTENS" );
+
+        for ( int row = 0; row < 6; row++ ){
+            const int abaqus_row = contractedIndex( row, NDI, NSHR );
+            for ( int col = 0; col < 6; col++ ){
+                const int abaqus_col = contractedIndex( col, NDI, NSHR );
+                matrixEntry( matrix_expansion, row, col ) = ( abaqus_row < 0 ) || ( abaqus_col < 0 ) ?
+                    std::remove_reference_t< decltype( matrixEntry( matrix_expansion, row, col ) ) >( 0 ) :
+                    matrixEntry( abaqus_matrix, abaqus_row, abaqus_col );
+            }
+        }
+    }
+
+    template< typename T, class Allocator >
+    inline std::vector< T, Allocator > expandFullNTENSTensor( const std::vector< T, Allocator > &long_vector,
+                                                              const bool abaqus_standard = true ){
+        /*!
+         * Expand the full 3x3 tensor as a row-major vector from the expanded Abaqus stress-type NTENS vector of
+         * length 6. Handle the stress-type vector element order differences between Abaqus/Standard and
+         * Abaqus/Explicit.
+         *
+         * ``tardigradeAbaqusTools::expandAbaqusNTENSVector`` returns
+         *
+         * Abaqus/Standard (UMAT)
+         *
+         *     long_vector[]            0            1            2          3          4          5
+         *                   { \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{13}, \tau_{23}  }
+         *
+         * Abaqus/Explicit (VUMAT)
+         *
+         *     long_vector[]            0            1            2          3          4          5
+         *                   { \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{23}, \tau_{13}  }
+         *
+         * \param &long_vector: a previously expanded Abaqus stress-type vector of length 6.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns full_tensor: c++ type row major vector of length 9.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensor, 15 * sizeof( T ) );
+
+        checkSize( long_vector, 6, "The expanded vector must have 6 entries" );
+
+        //Set the tensor packing order by Abaqus solver
+        const std::array< unsigned int, 9 > &tensorOrder = expandOrder( abaqusSolver( abaqus_standard ) );
+
+        //Pack the row-major full tensor
+        std::vector< T, Allocator > full_tensor( { long_vector[tensorOrder[0]], long_vector[tensorOrder[1]], long_vector[tensorOrder[2]],
+                                                   long_vector[tensorOrder[3]], long_vector[tensorOrder[4]], long_vector[tensorOrder[5]],
+                                                   long_vector[tensorOrder[6]], long_vector[tensorOrder[7]], long_vector[tensorOrder[8]] },
+                                                 long_vector.get_allocator( ) );
+
+        return full_tensor;
+
+    }
+
+    template< class Output, class Vector, typename = EnableIfVectorOutput< Output, Vector > >
+    inline void expandFullNTENSTensor( Output &&full_tensor, const Vector &long_vector,
+                                       const bool abaqus_standard = true ){
+        /*!
+         * Expand the full 3x3 tensor into a preallocated row-major vector from the expanded Abaqus stress-type NTENS
+         * vector of length 6.
+         *
+         * \param &&full_tensor: The destination row-major vector. Length 9.
+         * \param &long_vector: a previously expanded Abaqus stress-type vector of length 6.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensor, 15 * sizeof( ScalarType< Vector > ) );
+
+        checkSize( full_tensor, 9, "The full tensor must have 9 entries" );
+        checkSize( long_vector, 6, "The expanded vector must have 6 entries" );
+
+        //Set the tensor packing order by Abaqus solver
+        const std::array< unsigned int, 9 > &tensorOrder = expandOrder( abaqusSolver( abaqus_standard ) );
+
+        for ( unsigned int index = 0; index < 9; index++ ){
+            full_tensor[ index ] = long_vector[ tensorOrder[ index ] ];
+        }
+    }
+
+    template< typename T >
+    inline std::array< T, 9 > expandFullNTENSTensor( const std::array< T, 6 > &long_vector,
+                                                     const bool abaqus_standard = true ){
+        /*!
+         * Expand the full 3x3 tensor as a row-major array from the expanded Abaqus stress-type NTENS vector of
+         * length 6 without heap allocation.
+         *
+         * See the ``std::vector`` overload for the Abaqus component ordering.
+         *
+         * \param &long_vector: a previously expanded Abaqus stress-type vector of length 6.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns full_tensor: c++ type row major array of length 9.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensor, 15 * sizeof( T ) );
+
+        //Set the tensor packing order by Abaqus solver
+        const std::array< unsigned int, 9 > &tensorOrder = expandOrder( abaqusSolver( abaqus_standard ) );
+
+        //Pack the row-major full tensor
+        std::array< T, 9 > full_tensor;
+        for ( unsigned int index = 0; index < 9; index++ ){
+            full_tensor[ index ] = long_vector[ tensorOrder[ index ] ];
+        }
+
+        return full_tensor;
+
+    }
+
+    template< typename T, class Allocator >
+    inline std::vector< T, Allocator > expandFullNTENSTensor( const std::vector< T, Allocator > &abaqus_vector,
+                                                              const int &NDI, const int &NSHR,
+                                                              const bool abaqus_standard = true ){
+        /*!
+         * Expand the full 3x3 tensor as a row-major vector from the contracted Abaqus stress-type vector of length
+         * NDI + NSHR. Handle the stress-type vector element order differences between Abaqus/Standard and
+         * Abaqus/Explicit.
+         *
+         * \param &abaqus_vector: an abaqus stress-type vector with no by-definition-zero components. Length NDI + NSHR.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns full_tensor: c++ type row-major vector of length 9.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensor, ( NDI + NSHR + 9 ) * sizeof( T ) );
+
+        checkSize( abaqus_vector, NDI + NSHR, "The abaqus vector must have NDI + NSHR entries" );
+
+        //Expand the full tensor directly through the composite index map
+        std::vector< T, Allocator > full_tensor( 9, abaqus_vector.get_allocator( ) );
+        tardigradeAbaqusTools::lazyExpandFullNTENSTensor( abaqus_vector, NDI, NSHR, abaqus_standard ).evaluate( full_tensor );
+
+        return full_tensor;
+
+    }
+
+    template< class Output, class Vector, typename = EnableIfVectorOutput< Output, Vector > >
+    inline void expandFullNTENSTensor( Output &&full_tensor, const Vector &abaqus_vector,
+                                       const int &NDI, const int &NSHR, const bool abaqus_standard = true ){
+        /*!
+         * Expand the full 3x3 tensor into a preallocated row-major vector from the contracted Abaqus stress-type vector
+         * of length NDI + NSHR.
+         *
+         * \param &&full_tensor: The destination row-major vector. Length 9.
+         * \param &abaqus_vector: an abaqus stress-type vector with no by-definition-zero components, e.g. the ``STRESS``
+         *     pointer. Length NDI + NSHR.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensor,
+                                            ( NDI + NSHR + 9 ) * sizeof( ScalarType< Vector > ) );
+
+        checkSize( full_tensor, 9, "The full tensor must have 9 entries" );
+        checkSize( abaqus_vector, NDI + NSHR, "The abaqus vector must have NDI + NSHR entries" );
+
+        tardigradeAbaqusTools::lazyExpandFullNTENSTensor( abaqus_vector, NDI, NSHR, abaqus_standard ).evaluate( full_tensor );
+    }
+
+    template< typename T, std::size_t N >
+    inline std::array< T, 9 > expandFullNTENSTensor( const std::array< T, N > &abaqus_vector,
+                                                     const int &NDI, const int &NSHR,
+                                                     const bool abaqus_standard = true ){
+        /*!
+         * Expand the full 3x3 tensor as a row-major array from the contracted Abaqus stress-type vector of length
+         * NDI + NSHR without heap allocation.
+         *
+         * \param &abaqus_vector: an abaqus stress-type vector with no by-definition-zero components stored in the
+         *     leading NDI + NSHR entries.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns full_tensor: c++ type row-major array of length 9.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensor, ( NDI + NSHR + 9 ) * sizeof( T ) );
+
+        checkSize( abaqus_vector, NDI + NSHR, "The abaqus vector must have NDI + NSHR entries" );
+
+        return tardigradeAbaqusTools::lazyExpandFullNTENSTensor( abaqus_vector, NDI, NSHR, abaqus_standard );
+
+    }
+
+    template< typename T, int HEIGHT, int WIDTH, class Allocator = std::allocator< std::remove_const_t< T > >,
+              typename = EnableIfAllocator< Allocator, std::remove_const_t< T > > >
+    inline std::vector< std::remove_const_t< T >, Allocator > expandFullNTENSTensor( const ColumnMajorView< T, HEIGHT, WIDTH > &abaqus_vector,
+                                                                                   const int &NDI, const int &NSHR,
+                                                                                   const bool abaqus_standard = true,
+                                                                                   const Allocator &allocator = Allocator( ) ){
+        /*!
+         * Expand the full 3x3 tensor as a row-major vector directly from a view of the contracted Abaqus stress-type
+         * vector of length NDI + NSHR, e.g. the ``STRESS`` pointer.
+         *
+         * \param &abaqus_vector: a view of an abaqus stress-type vector with no by-definition-zero components. Size
+         *     NDI + NSHR.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \param &allocator: The allocator of the returned vector. Default: ``std::allocator``.
+         * \returns full_tensor: c++ type row-major vector of length 9.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensor, ( NDI + NSHR + 9 ) * sizeof( T ) );
+
+        checkSize( abaqus_vector, NDI + NSHR, "The abaqus vector must have NDI + NSHR entries" );
+
+        std::vector< std::remove_const_t< T >, Allocator > full_tensor( 9, allocator );
+        tardigradeAbaqusTools::lazyExpandFullNTENSTensor( abaqus_vector, NDI, NSHR, abaqus_standard ).evaluate( full_tensor );
+
+        return full_tensor;
+
+    }
+
+    template< typename T, class Allocator >
+    inline std::vector< T, Allocator > contractFullNTENSTensor( const std::vector< T, Allocator > &full_tensor,
+                                                                const bool abaqus_standard = true ){
+        /*!
+         * Contract a full 3x3 tensor stored as a row-major vector into the full Abaqus stress-type vector of length 6.
+         * Handle the stress-type vector element order differences between Abaqus/Standard and Abaqus/Explicit.
+         *
+         * The full tensor is stored as a row-major vector
+         *
+         *     full_tensor[]            0            1            2
+         *                   { \sigma_{11}, \sigma_{12}, \sigma_{13},
+         *
+         *     full_tensor[]            3            4            5
+         *                     \sigma_{12}, \sigma_{22}, \sigma_{23},
+         *
+         *     full_tensor[]            6            7            8
+         *                     \sigma_{13}, \sigma_{23}, \sigma_{33} }
+         *
+         * \param full_tensor: c++ type row-major vector of length 9.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns &full_abaqus_vector: an expanded abaqus stress-type vector. Length 6.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSTensor, 15 * sizeof( T ) );
+
+        checkSize( full_tensor, 9, "The full tensor must have 9 entries" );
+
+        //Set the tensor unpacking order by Abaqus solver
+        const std::array< unsigned int, 6 > &tensorOrder = contractOrder( abaqusSolver( abaqus_standard ) );
+
+        //Unpack the row-major full tensor
+        std::vector< T, Allocator > full_abaqus_vector( { full_tensor[tensorOrder[0]], full_tensor[tensorOrder[1]], full_tensor[tensorOrder[2]],
+                                                          full_tensor[tensorOrder[3]], full_tensor[tensorOrder[4]], full_tensor[tensorOrder[5]] },
+                                                        full_tensor.get_allocator( ) );
+
+        return full_abaqus_vector;
+
+    }
+
+    template< class Output, class Tensor, typename = EnableIfVectorOutput< Output, Tensor > >
+    inline void contractFullNTENSTensor( Output &&full_abaqus_vector, const Tensor &full_tensor,
+                                         const bool abaqus_standard = true ){
+        /*!
+         * Contract a full 3x3 tensor stored as a row-major vector into a preallocated full Abaqus stress-type vector of
+         * length 6.
+         *
+         * \param &&full_abaqus_vector: The destination expanded abaqus stress-type vector. Length 6.
+         * \param &full_tensor: c++ type row-major vector of length 9.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSTensor, 15 * sizeof( ScalarType< Tensor > ) );
+
+        checkSize( full_abaqus_vector, 6, "The expanded vector must have 6 entries" );
+        checkSize( full_tensor, 9, "The full tensor must have 9 entries" );
+
+        //Set the tensor unpacking order by Abaqus solver
+        const std::array< unsigned int, 6 > &tensorOrder = contractOrder( abaqusSolver( abaqus_standard ) );
+
+        for ( unsigned int index = 0; index < 6; index++ ){
+            full_abaqus_vector[ index ] = full_tensor[ tensorOrder[ index ] ];
+        }
+    }
+
+    template< typename T >
+    inline std::array< T, 6 > contractFullNTENSTensor( const std::array< T, 9 > &full_tensor,
+                                                       const bool abaqus_standard = true ){
+        /*!
+         * Contract a full 3x3 tensor stored as a row-major array into the full Abaqus stress-type vector of length 6
+         * without heap allocation.
+         *
+         * See the ``std::vector`` overload for the full tensor ordering.
+         *
+         * \param full_tensor: c++ type row-major array of length 9.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns &full_abaqus_vector: an expanded abaqus stress-type array. Length 6.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSTensor, 15 * sizeof( T ) );
+
+        //Set the tensor unpacking order by Abaqus solver
+        const std::array< unsigned int, 6 > &tensorOrder = contractOrder( abaqusSolver( abaqus_standard ) );
+
+        //Unpack the row-major full tensor
+        std::array< T, 6 > full_abaqus_vector;
+        for ( unsigned int index = 0; index < 6; index++ ){
+            full_abaqus_vector[ index ] = full_tensor[ tensorOrder[ index ] ];
+        }
+
+        return full_abaqus_vector;
+
+    }
+
+    template< typename T, class Allocator >
+    inline std::vector< T, Allocator > contractFullNTENSTensor( const std::vector< T, Allocator > &full_tensor,
+                                                                const int &NDI, const int &NSHR,
+                                                                const bool abaqus_standard = true ){
+        /*!
+         * Contract a full 3x3 tensor stored as a row-major vector into an Abaqus stress-type vector of length NDI +
+         * NSHR. Handle the stress-type vector element order differences between Abaqus/Standard and Abaqus/Explicit.
+         *
+         * The full tensor is stored as a row-major vector
+         *
+         *     full_tensor[]            0            1            2
+         *                   { \sigma_{11}, \sigma_{12}, \sigma_{13},
+         *
+         *     full_tensor[]            3            4            5
+         *                     \sigma_{12}, \sigma_{22}, \sigma_{23},
+         *
+         *     full_tensor[]            6            7            8
+         *                     \sigma_{13}, \sigma_{23}, \sigma_{33} }
+         *
+         * \param full_tensor: c++ type row-major vector of length 9.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns &abaqus_vector: a contracted abaqus stress-type vector. Length NDI + NSHR.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSTensor, ( NDI + NSHR + 9 ) * sizeof( T ) );
+
+        checkSize( full_tensor, 9, "The full tensor must have 9 entries" );
+
+        //Contract directly to an abaqus stress-type vector of length NDI + NSHR through the composite index map
+        std::vector< T, Allocator > abaqus_vector( NDI + NSHR, full_tensor.get_allocator( ) );
+        tardigradeAbaqusTools::lazyContractFullNTENSTensor( full_tensor, NDI, NSHR, abaqus_standard ).evaluate( abaqus_vector );
+
+        return abaqus_vector;
+
+    }
+
+    template< class Output, class Tensor, typename = EnableIfVectorOutput< Output, Tensor > >
+    inline void contractFullNTENSTensor( Output &&abaqus_vector, const Tensor &full_tensor,
+                                         const int &NDI, const int &NSHR, const bool abaqus_standard = true ){
+        /*!
+         * Contract a full 3x3 tensor stored as a row-major vector into a preallocated Abaqus stress-type vector of
+         * length NDI + NSHR, e.g. the ``STRESS`` pointer.
+         *
+         * \param &&abaqus_vector: The destination contracted abaqus stress-type vector. Length NDI + NSHR.
+         * \param &full_tensor: c++ type row-major vector of length 9.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSTensor,
+                                            ( NDI + NSHR + 9 ) * sizeof( ScalarType< Tensor > ) );
+
+        checkSize( abaqus_vector, NDI + NSHR, "The abaqus vector must have NDI + NSHR entries" );
+        checkSize( full_tensor, 9, "The full tensor must have 9 entries" );
+
+        tardigradeAbaqusTools::lazyContractFullNTENSTensor( full_tensor, NDI, NSHR, abaqus_standard ).evaluate( abaqus_vector );
+    }
+
+    template< typename T >
+    inline std::array< T, 6 > contractFullNTENSTensor( const std::array< T, 9 > &full_tensor,
+                                                       const int &NDI, const int &NSHR,
+                                                       const bool abaqus_standard = true ){
+        /*!
+         * Contract a full 3x3 tensor stored as a row-major array into an Abaqus stress-type vector of length NDI +
+         * NSHR without heap allocation.
+         *
+         * \param full_tensor: c++ type row-major array of length 9.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns &abaqus_vector: a contracted abaqus stress-type array. The contracted vector occupies the leading
+         *     NDI + NSHR entries and the trailing entries are zero.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSTensor, ( NDI + NSHR + 9 ) * sizeof( T ) );
+
+        return tardigradeAbaqusTools::lazyContractFullNTENSTensor( full_tensor, NDI, NSHR, abaqus_standard );
+
+    }
+
+    template< typename T, class Allocator >
+    inline VectorOfVectors< T, Allocator > contractFullNTENSMatrix( const VectorOfVectors< T, Allocator > &full_matrix,
+                                                                    const bool abaqus_standard = true ){
+        /*!
+         * Re-pack a full 9x9 matrix into the expected order for an expanded (6x6) Abaqus NTENS matrix, e.g. Jaumann
+         * stiffness matrix. Handle the stress-type vector element order differences between Abaqus/Standard and
+         * Abaqus/Explicit.
+         *
+         * Full 9x9 Matrix
+         *
+         * \f$ \left ( D_{1111}, D_{1112}, D_{1113}, D_{1121}, D_{1122}, D_{1123}, D_{1131}, D_{1132}, D_{1133} \right ) \f$
+         * \f$ \left ( D_{1211}, D_{1212}, D_{1213}, D_{1221}, D_{1222}, D_{1223}, D_{1231}, D_{1232}, D_{1233} \right ) \f$
+         * \f$ \left ( D_{1311}, D_{1312}, D_{1313}, D_{1321}, D_{1322}, D_{1323}, D_{1331}, D_{1332}, D_{1333} \right ) \f$
+         * \f$ \left ( D_{2111}, D_{2112}, D_{2113}, D_{2121}, D_{2122}, D_{2123}, D_{2131}, D_{2132}, D_{2133} \right ) \f$
+         * \f$ \left ( D_{2211}, D_{2212}, D_{2213}, D_{2221}, D_{2222}, D_{2223}, D_{2231}, D_{2232}, D_{2233} \right ) \f$
+         * \f$ \left ( D_{2311}, D_{2312}, D_{2313}, D_{2321}, D_{2322}, D_{2323}, D_{2331}, D_{2332}, D_{2333} \right ) \f$
+         * \f$ \left ( D_{3111}, D_{3112}, D_{3113}, D_{3121}, D_{3122}, D_{3123}, D_{3131}, D_{3132}, D_{3133} \right ) \f$
+         * \f$ \left ( D_{3211}, D_{3212}, D_{3213}, D_{3221}, D_{3222}, D_{3223}, D_{3231}, D_{3232}, D_{3233} \right ) \f$
+         * \f$ \left ( D_{3311}, D_{3312}, D_{3313}, D_{3321}, D_{3322}, D_{3323}, D_{3331}, D_{3332}, D_{3333} \right ) \f$
+         *
+         * Abaqus/Standard 6x6 Matrix
+         *
+         * \f$ \left ( D_{1111}, D_{1122}, D_{1133}, D_{1112}, D_{1113}, D_{1123} \right ) \f$
+         * \f$ \left ( D_{2211}, D_{2222}, D_{2233}, D_{2212}, D_{2213}, D_{2223} \right ) \f$
+         * \f$ \left ( D_{3311}, D_{3322}, D_{3333}, D_{3312}, D_{3313}, D_{3323} \right ) \f$
+         * \f$ \left ( D_{1211}, D_{1222}, D_{1233}, D_{1212}, D_{1213}, D_{1223} \right ) \f$
+         * \f$ \left ( D_{1311}, D_{1322}, D_{1333}, D_{1312}, D_{1313}, D_{1323} \right ) \f$
+         * \f$ \left ( D_{2311}, D_{2322}, D_{2333}, D_{2312}, D_{2313}, D_{2323} \right ) \f$
+         *
+         * The Abaqus/Explicit 6x6 matrix swaps the 13 and 23 rows and columns.
+         *
+         * \param full_matrix: The c++ type matrix (vector of vectors) 9x9.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns full_abaqus_matrix: Expanded 6x6 Voigt matrix with Abaqus element ordering.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSMatrix, 117 * sizeof( T ) );
+
+        checkSize( full_matrix, 9, 9, "The full matrix must be 9x9" );
+
+        //Initialize internal vectors
+        VectorOfVectors< T, Allocator > full_abaqus_matrix = allocateVectorOfVectors< T >( 6, 6, Allocator( full_matrix.get_allocator( ) ) );
+
+        //Set the tensor packing order by Abaqus solver
+        const std::array< unsigned int, 6 > &tensorOrder = contractOrder( abaqusSolver( abaqus_standard ) );
+
+        //Repack the full matrix for Abaqus
+        for ( unsigned int i = 0; i < tensorOrder.size( ); i++ ){
+            for ( unsigned int j = 0; j < tensorOrder.size( ); j++ ){
+                full_abaqus_matrix[ i ][ j ] = full_matrix[ tensorOrder[ i ] ][ tensorOrder[ j ] ];
+            }
+        }
+
+        return full_abaqus_matrix;
+
+    }
+
+    template< typename T, class Allocator >
+    inline VectorOfVectors< T, Allocator > contractFullNTENSMatrix( const VectorOfVectors< T, Allocator > &full_matrix,
+                                                                    const int &NDI, const int &NSHR,
+                                                                    const bool abaqus_standard = true ){
+        /*!
+         * Re-pack a full 9x9 matrix into the expected order for the contracted (NTENSxNTENS) Abaqus NTENS matrix, e.g.
+         * Jaumann stiffness matrix. Handle the stress-type vector element order differences between Abaqus/Standard and
+         * Abaqus/Explicit.
+         *
+         * Full 9x9 Matrix
+         *
+         * \f$ \left ( D_{1111}, D_{1112}, D_{1113}, D_{1121}, D_{1122}, D_{1123}, D_{1131}, D_{1132}, D_{1133} \right ) \f$
+         * \f$ \left ( D_{1211}, D_{1212}, D_{1213}, D_{1221}, D_{1222}, D_{1223}, D_{1231}, D_{1232}, D_{1233} \right ) \f$
+         * \f$ \left ( D_{1311}, D_{1312}, D_{1313}, D_{1321}, D_{1322}, D_{1323}, D_{1331}, D_{1332}, D_{1333} \right ) \f$
+         * \f$ \left ( D_{2111}, D_{2112}, D_{2113}, D_{2121}, D_{2122}, D_{2123}, D_{2131}, D_{2132}, D_{2133} \right ) \f$
+         * \f$ \left ( D_{2211}, D_{2212}, D_{2213}, D_{2221}, D_{2222}, D_{2223}, D_{2231}, D_{2232}, D_{2233} \right ) \f$
+         * \f$ \left ( D_{2311}, D_{2312}, D_{2313}, D_{2321}, D_{2322}, D_{2323}, D_{2331}, D_{2332}, D_{2333} \right ) \f$
+         * \f$ \left ( D_{3111}, D_{3112}, D_{3113}, D_{3121}, D_{3122}, D_{3123}, D_{3131}, D_{3132}, D_{3133} \right ) \f$
+         * \f$ \left ( D_{3211}, D_{3212}, D_{3213}, D_{3221}, D_{3222}, D_{3223}, D_{3231}, D_{3232}, D_{3233} \right ) \f$
+         * \f$ \left ( D_{3311}, D_{3312}, D_{3313}, D_{3321}, D_{3322}, D_{3323}, D_{3331}, D_{3332}, D_{3333} \right ) \f$
+         *
+         * Abaqus/Standard 6x6 Matrix
+         *
+         * \f$ \left ( D_{1111}, D_{1122}, D_{1133}, D_{1112}, D_{1113}, D_{1123} \right ) \f$
+         * \f$ \left ( D_{2211}, D_{2222}, D_{2233}, D_{2212}, D_{2213}, D_{2223} \right ) \f$
+         * \f$ \left ( D_{3311}, D_{3322}, D_{3333}, D_{3312}, D_{3313}, D_{3323} \right ) \f$
+         * \f$ \left ( D_{1211}, D_{1222}, D_{1233}, D_{1212}, D_{1213}, D_{1223} \right ) \f$
+         * \f$ \left ( D_{1311}, D_{1322}, D_{1333}, D_{1312}, D_{1313}, D_{1323} \right ) \f$
+         * \f$ \left ( D_{2311}, D_{2322}, D_{2333}, D_{2312}, D_{2313}, D_{2323} \right ) \f$
+         *
+         * Where the output matrix from this function omits the by-definition zero valued components determined by NDI
+         * and NSHR.
+         *
+         * \param full_matrix: The c++ type matrix (vector of vectors) 9x9.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns &abaqus_matrix: A contracted Abaqus Voigt matrix with dimensions NTENSxNTENS where NTENS = NDI +
+         *                          NSHR.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSMatrix,
+                                            ( 81 + ( NDI + NSHR ) * ( NDI + NSHR ) ) * sizeof( T ) );
+
+        //Detruct to 6x6
+        VectorOfVectors< T, Allocator > full_abaqus_matrix = contractFullNTENSMatrix( full_matrix, abaqus_standard );
+
+        //Contract to NTENSxNTENS
+        VectorOfVectors< T, Allocator > abaqus_matrix = contractAbaqusNTENSMatrix( full_abaqus_matrix, NDI, NSHR );
+
+        return abaqus_matrix;
+
+    }
+
+    template< class Output, class Matrix, typename = EnableIfMatrixOutput< Output, Matrix > >
+    inline void contractFullNTENSMatrix( Output &&full_abaqus_matrix, const Matrix &full_matrix,
+                                         const bool abaqus_standard = true ){
+        /*!
+         * Re-pack a full 9x9 matrix into a preallocated expanded (6x6) Abaqus NTENS matrix.
+         *
+         * \param &&full_abaqus_matrix: The destination 6x6 Voigt matrix with Abaqus element ordering.
+         * \param &full_matrix: The 9x9 matrix, e.g. a vector of vectors.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSMatrix, 117 * sizeof( MatrixScalarType< Matrix > ) );
+
+        checkSize( full_abaqus_matrix, 6, 6, "The expanded matrix must be 6x6" );
+        checkSize( full_matrix, 9, 9, "The full matrix must be 9x9" );
+
+        //Set the tensor packing order by Abaqus solver
+        const std::array< unsigned int, 6 > &tensorOrder = contractOrder( abaqusSolver( abaqus_standard ) );
+
+        for ( unsigned int i = 0; i < 6; i++ ){
+            for ( unsigned int j = 0; j < 6; j++ ){
+                matrixEntry( full_abaqus_matrix, i, j ) = matrixEntry( full_matrix, tensorOrder[ i ], tensorOrder[ j ] );
+            }
+        }
+    }
+
+    template< class Output, class Matrix, typename = EnableIfMatrixOutput< Output, Matrix > >
+    inline void contractFullNTENSMatrix( Output &&abaqus_matrix, const Matrix &full_matrix,
+                                         const int &NDI, const int &NSHR, const bool abaqus_standard = true ){
+        /*!
+         * Re-pack a full 9x9 matrix into a preallocated contracted (NTENSxNTENS) Abaqus NTENS matrix in a single pass.
+         *
+         * \param &&abaqus_matrix: The destination matrix, e.g. a ``ColumnMajorView`` of ``DDSDDE``. Dimensions
+         *     NTENSxNTENS where NTENS = NDI + NSHR.
+         * \param &full_matrix: The 9x9 matrix, e.g. a vector of vectors.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSMatrix,
+                                            ( 81 + ( NDI + NSHR ) * ( NDI + NSHR ) ) * sizeof( MatrixScalarType< Matrix > ) );
+
+        const int NTENS = NDI + NSHR;
+        checkSize( abaqus_matrix, NTENS, NTENS, "The contracted matrix must be NTENSxNTENS" );
+        checkSize( full_matrix, 9, 9, "The full matrix must be 9x9" );
+
+        //Row-major full tensor index of each NTENS component
+        const std::array< unsigned int, 6 > fullIndex = NTENSFullTensorIndex( NDI, NSHR, abaqus_standard );
+
+        for ( int row = 0; row < NTENS; row++ ){
+            for ( int col = 0; col < NTENS; col++ ){
+                matrixEntry( abaqus_matrix, row, col ) = matrixEntry( full_matrix, fullIndex[ row ], fullIndex[ col ] );
+            }
+        }
+    }
+
+    template< typename T, class Allocator >
+    inline VectorOfVectors< T, Allocator > expandFullNTENSMatrix( const VectorOfVectors< T, Allocator > &full_abaqus_matrix,
+                                                                  const bool abaqus_standard = true ){
+        /*!
+         * Expand an expanded (6x6) Abaqus NTENS matrix into the full 9x9 matrix, e.g. Jaumann stiffness matrix. The
+         * inverse of ``contractFullNTENSMatrix`` for matrices with minor symmetry. Handle the stress-type vector element
+         * order differences between Abaqus/Standard and Abaqus/Explicit.
+         *
+         * See ``contractFullNTENSMatrix`` for the matrix component ordering.
+         *
+         * \param &full_abaqus_matrix: Expanded 6x6 Voigt matrix with Abaqus element ordering.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns full_matrix: The c++ type matrix (vector of vectors) 9x9.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSMatrix, 117 * sizeof( T ) );
+
+        checkSize( full_abaqus_matrix, 6, 6, "The expanded matrix must be 6x6" );
+
+        //Set the tensor unpacking order by Abaqus solver
+        const std::array< unsigned int, 9 > &tensorOrder = expandOrder( abaqusSolver( abaqus_standard ) );
+
+        //Unpack the Abaqus matrix
+        VectorOfVectors< T, Allocator > full_matrix = allocateVectorOfVectors< T >( 9, 9, Allocator( full_abaqus_matrix.get_allocator( ) ) );
+        for ( unsigned int i = 0; i < tensorOrder.size( ); i++ ){
+            for ( unsigned int j = 0; j < tensorOrder.size( ); j++ ){
+                full_matrix[ i ][ j ] = full_abaqus_matrix[ tensorOrder[ i ] ][ tensorOrder[ j ] ];
+            }
+        }
+
+        return full_matrix;
+
+    }
+
+    template< typename T, class Allocator >
+    inline VectorOfVectors< T, Allocator > expandFullNTENSMatrix( const VectorOfVectors< T, Allocator > &abaqus_matrix,
+                                                                  const int &NDI, const int &NSHR,
+                                                                  const bool abaqus_standard = true ){
+        /*!
+         * Expand a contracted (NTENSxNTENS) Abaqus NTENS matrix into the full 9x9 matrix, e.g. Jaumann stiffness matrix.
+         * The inverse of ``contractFullNTENSMatrix`` for matrices with minor symmetry. The by-definition-zero
+         * components are zero.
+         *
+         * \param &abaqus_matrix: A contracted Abaqus Voigt matrix with dimensions NTENSxNTENS where NTENS = NDI + NSHR.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns full_matrix: The c++ type matrix (vector of vectors) 9x9.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSMatrix,
+                                            ( 81 + ( NDI + NSHR ) * ( NDI + NSHR ) ) * sizeof( T ) );
+
+        checkSize( abaqus_matrix, NDI + NSHR, NDI + NSHR, "The contracted matrix must be NTENSxNTENS" );
+
+        //Contracted vector index of each full tensor component
+        const std::array< int, 9 > fullIndex = fullTensorNTENSIndex( NDI, NSHR, abaqus_standard );
+
+        //Unpack the Abaqus matrix without forming the 6x6 matrix
+        VectorOfVectors< T, Allocator > full_matrix = allocateVectorOfVectors< T >( 9, 9, Allocator( abaqus_matrix.get_allocator( ) ) );
+        for ( unsigned int i = 0; i < 9; i++ ){
+            if ( fullIndex[ i ] < 0 ){
+                continue;
+            }
+            for ( unsigned int j = 0; j < 9; j++ ){
+                if ( fullIndex[ j ] < 0 ){
+                    continue;
+                }
+                full_matrix[ i ][ j ] = abaqus_matrix[ fullIndex[ i ] ][ fullIndex[ j ] ];
+            }
+        }
+
+        return full_matrix;
+
+    }
+
+    template< class Output, class Matrix, typename = EnableIfMatrixOutput< Output, Matrix > >
+    inline void expandFullNTENSMatrix( Output &&full_matrix, const Matrix &full_abaqus_matrix,
+                                       const bool abaqus_standard = true ){
+        /*!
+         * Expand an expanded (6x6) Abaqus NTENS matrix into a preallocated full 9x9 matrix.
+         *
+         * \param &&full_matrix: The destination 9x9 matrix, e.g. a vector of vectors.
+         * \param &full_abaqus_matrix: Expanded 6x6 Voigt matrix with Abaqus element ordering.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSMatrix, 117 * sizeof( MatrixScalarType< Matrix > ) );
+
+        checkSize( full_matrix, 9, 9, "The full matrix must be 9x9" );
+        checkSize( full_abaqus_matrix, 6, 6, "The expanded matrix must be 6x6" );
+
+        //Set the tensor unpacking order by Abaqus solver
+        const std::array< unsigned int, 9 > &tensorOrder = expandOrder( abaqusSolver( abaqus_standard ) );
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+            for ( unsigned int j = 0; j < 9; j++ ){
+                matrixEntry( full_matrix, i, j ) = matrixEntry( full_abaqus_matrix, tensorOrder[ i ], tensorOrder[ j ] );
+            }
+        }
+    }
+
+    template< class Output, class Matrix, typename = EnableIfMatrixOutput< Output, Matrix > >
+    inline void expandFullNTENSMatrix( Output &&full_matrix, const Matrix &abaqus_matrix,
+                                       const int &NDI, const int &NSHR, const bool abaqus_standard = true ){
+        /*!
+         * Expand a contracted (NTENSxNTENS) Abaqus NTENS matrix into a preallocated full 9x9 matrix in a single pass.
+         * The by-definition-zero components are zero.
+         *
+         * \param &&full_matrix: The destination 9x9 matrix, e.g. a vector of vectors.
+         * \param &abaqus_matrix: A contracted Abaqus Voigt matrix, e.g. a ``ColumnMajorView`` of ``DDSDDE``. Dimensions
+         *     NTENSxNTENS where NTENS = NDI + NSHR.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSMatrix,
+                                            ( 81 + ( NDI + NSHR ) * ( NDI + NSHR ) ) * sizeof( MatrixScalarType< Matrix > ) );
+
+        checkSize( full_matrix, 9, 9, "The full matrix must be 9x9" );
+        checkSize( abaqus_matrix, NDI + NSHR, NDI + NSHR, "The contracted matrix must be NTENSxNTENS" );
+
+        //Contracted vector index of each full tensor component
+        const std::array< int, 9 > fullIndex = fullTensorNTENSIndex( NDI, NSHR, abaqus_standard );
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+            for ( unsigned int j = 0; j < 9; j++ ){
+                matrixEntry( full_matrix, i, j ) = ( fullIndex[ i ] < 0 ) || ( fullIndex[ j ] < 0 ) ?
+                    std::remove_reference_t< decltype( matrixEntry( full_matrix, i, j ) ) >( 0 ) :
+                    matrixEntry( abaqus_matrix, fullIndex[ i ], fullIndex[ j ] );
+            }
+        }
+    }
+
+    template< typename T >
+    inline std::array< T, 36 > contractFullNTENSMatrix( const std::array< T, 81 > &full_matrix,
+                                                        const bool abaqus_standard = true ){
+        /*!
+         * Re-pack a flat, row-major 9x9 matrix into a flat, row-major expanded (6x6) Abaqus NTENS matrix, e.g. Jaumann
+         * stiffness matrix.
+         *
+         * See the vector of vectors overload for the matrix component ordering.
+         *
+         * \param full_matrix: The flat, row-major 9x9 matrix.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns full_abaqus_matrix: Flat, row-major expanded 6x6 Voigt matrix with Abaqus element ordering.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSMatrix, 117 * sizeof( T ) );
+
+        //Set the tensor packing order by Abaqus solver
+        const std::array< unsigned int, 6 > &tensorOrder = contractOrder( abaqusSolver( abaqus_standard ) );
+
+        //Repack the full matrix for Abaqus
+        std::array< T, 36 > full_abaqus_matrix;
+        for ( unsigned int i = 0; i < 6; i++ ){
+            for ( unsigned int j = 0; j < 6; j++ ){
+                full_abaqus_matrix[ 6 * i + j ] = full_matrix[ 9 * tensorOrder[ i ] + tensorOrder[ j ] ];
+            }
+        }
+
+        return full_abaqus_matrix;
+
+    }
+
+    template< typename T >
+    inline void contractAbaqusNTENSMatrix( T *abaqus_matrix, const std::array< T, 36 > &full_abaqus_matrix,
+                                           const int &NDI, const int &NSHR ){
+        /*!
+         * Contract NTENS type components from a flat, row-major expanded Abaqus stress-type matrix (6x6) directly into
+         * a column major (Fortran) NTENSxNTENS array, e.g. the ``DDSDDE`` pointer. ONLY APPLIES TO ABAQUS/STANDARD
+         * Voigt matrices, e.g. Jaumann stiffness matrix.
+         *
+         * \param *abaqus_matrix: The pointer to the start of the column major NTENSxNTENS array
+         * \param &full_abaqus_matrix: a previously expanded, flat, row-major abaqus NTENS matrix. Dimensions 6x6.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractAbaqusNTENSMatrix,
+                                            ( 36 + ( NDI + NSHR ) * ( NDI + NSHR ) ) * sizeof( T ) );
+
+        checkNTENS( NDI, NSHR );
+
+        const int NTENS = NDI + NSHR;
+
+        //Expanded Abaqus vector index of each NTENS component
+        unsigned int longIndex[ 6 ];
+        for ( int index = 0; index < NTENS; index++ ){
+            longIndex[ index ] = index < NDI ? index : 3 + index - NDI;
+        }
+
+        for ( int col = 0; col < NTENS; col++ ){
+            for ( int row = 0; row < NTENS; row++ ){
+                abaqus_matrix[ col * NTENS + row ] = full_abaqus_matrix[ 6 * longIndex[ row ] + longIndex[ col ] ];
+            }
+        }
+
+    }
+
+    template< typename T, typename U >
+    inline void contractFullNTENSMatrix( T *abaqus_matrix, const U *full_matrix, const int &NDI, const int &NSHR,
+                                         const bool abaqus_standard = true, const bool symmetric = false ){
+        /*!
+         * Re-pack a flat, row-major 9x9 matrix directly into a column major (Fortran) NTENSxNTENS array, e.g. the
+         * ``DDSDDE`` pointer, in a single pass. No intermediate 6x6 matrix is formed.
+         *
+         * When ``symmetric`` is true the matrix is assumed to have major symmetry and only the NTENS ( NTENS + 1 ) / 2
+         * independent entries, 21 for NTENS = 6, are read from the full matrix. Each is written to both triangles of
+         * the Abaqus matrix.
+         *
+         * The scalar types may differ, e.g. a single precision DDSDDE array written from a double precision tangent.
+         *
+         * See the vector of vectors overloads for the matrix component ordering.
+         *
+         * \param *abaqus_matrix: The pointer to the start of the column major NTENSxNTENS array
+         * \param *full_matrix: The pointer to the start of the flat, row-major 9x9 matrix. Length 81.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \param symmetric: boolean for a major symmetric matrix. Default: False.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSMatrix,
+                                            81 * sizeof( U ) + ( NDI + NSHR ) * ( NDI + NSHR ) * sizeof( T ) );
+
+        const int NTENS = NDI + NSHR;
+
+        //Row-major full tensor index of each NTENS component
+        const std::array< unsigned int, 6 > fullIndex = NTENSFullTensorIndex( NDI, NSHR, abaqus_standard );
+
+        if ( symmetric ){
+            for ( int col = 0; col < NTENS; col++ ){
+                for ( int row = 0; row <= col; row++ ){
+                    const T value = static_cast< T >( full_matrix[ 9 * fullIndex[ row ] + fullIndex[ col ] ] );
+                    abaqus_matrix[ col * NTENS + row ] = value;
+                    abaqus_matrix[ row * NTENS + col ] = value;
+                }
+            }
+            return;
+        }
+
+        for ( int col = 0; col < NTENS; col++ ){
+            for ( int row = 0; row < NTENS; row++ ){
+                abaqus_matrix[ col * NTENS + row ] = static_cast< T >( full_matrix[ 9 * fullIndex[ row ] + fullIndex[ col ] ] );
+            }
+        }
+
+    }
+
+    template< typename T, typename U >
+    inline void contractFullNTENSMatrix( T *abaqus_matrix, const std::array< U, 81 > &full_matrix,
+                                         const int &NDI, const int &NSHR,
+                                         const bool abaqus_standard = true, const bool symmetric = false ){
+        /*!
+         * Re-pack a flat, row-major 9x9 matrix directly into a column major (Fortran) NTENSxNTENS array, e.g. the
+         * ``DDSDDE`` pointer, in a single pass.
+         *
+         * \param *abaqus_matrix: The pointer to the start of the column major NTENSxNTENS array
+         * \param &full_matrix: The flat, row-major 9x9 matrix.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \param symmetric: boolean for a major symmetric matrix. Default: False.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSMatrix,
+                                            81 * sizeof( U ) + ( NDI + NSHR ) * ( NDI + NSHR ) * sizeof( T ) );
+
+        contractFullNTENSMatrix( abaqus_matrix, full_matrix.data( ), NDI, NSHR, abaqus_standard, symmetric );
+
+    }
+
+    template< typename T >
+    inline std::array< T, 81 > expandFullNTENSMatrix( const std::array< T, 36 > &full_abaqus_matrix,
+                                                      const bool abaqus_standard = true ){
+        /*!
+         * Expand a flat, row-major expanded (6x6) Abaqus NTENS matrix into a flat, row-major 9x9 matrix. The inverse
+         * of ``contractFullNTENSMatrix`` for matrices with minor symmetry.
+         *
+         * \param &full_abaqus_matrix: Flat, row-major expanded 6x6 Voigt matrix with Abaqus element ordering.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns full_matrix: The flat, row-major 9x9 matrix.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSMatrix, 117 * sizeof( T ) );
+
+        //Set the tensor unpacking order by Abaqus solver
+        const std::array< unsigned int, 9 > &tensorOrder = expandOrder( abaqusSolver( abaqus_standard ) );
+
+        //Unpack the Abaqus matrix
+        std::array< T, 81 > full_matrix;
+        for ( unsigned int i = 0; i < 9; i++ ){
+            for ( unsigned int j = 0; j < 9; j++ ){
+                full_matrix[ 9 * i + j ] = full_abaqus_matrix[ 6 * tensorOrder[ i ] + tensorOrder[ j ] ];
+            }
+        }
+
+        return full_matrix;
+
+    }
+
+    template< typename T, typename U >
+    inline void expandFullNTENSMatrix( T *full_matrix, const U *abaqus_matrix, const int &NDI, const int &NSHR,
+                                       const bool abaqus_standard = true, const bool symmetric = false ){
+        /*!
+         * Expand a column major (Fortran) NTENSxNTENS array, e.g. the ``DDSDDE`` pointer, directly into a flat,
+         * row-major 9x9 matrix in a single pass. No intermediate 6x6 matrix is formed. The inverse of
+         * ``contractFullNTENSMatrix`` for matrices with minor symmetry. The by-definition-zero components are zero.
+         *
+         * When ``symmetric`` is true the matrix is assumed to have major symmetry and only the upper triangle of the
+         * Abaqus matrix, 21 entries for NTENS = 6, is read. The lower triangle of the Abaqus matrix may be
+         * uninitialized.
+         *
+         * The scalar types may differ, e.g. a single precision DDSDDE array expanded into a double precision tangent.
+         *
+         * \param *full_matrix: The pointer to the start of the flat, row-major 9x9 matrix. Length 81.
+         * \param *abaqus_matrix: The pointer to the start of the column major NTENSxNTENS array
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \param symmetric: boolean for a major symmetric matrix. Default: False.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSMatrix,
+                                            81 * sizeof( T ) + ( NDI + NSHR ) * ( NDI + NSHR ) * sizeof( U ) );
+
+        const int NTENS = NDI + NSHR;
+
+        //Contracted vector index of each full tensor component
+        const std::array< int, 9 > fullIndex = fullTensorNTENSIndex( NDI, NSHR, abaqus_standard );
+
+        //Mirror the upper triangle so that the lower triangle is never read
+        U symmetric_matrix[ 36 ];
+        const U *source = abaqus_matrix;
+        if ( symmetric ){
+            for ( int col = 0; col < NTENS; col++ ){
+                for ( int row = 0; row <= col; row++ ){
+                    const U value = abaqus_matrix[ col * NTENS + row ];
+                    symmetric_matrix[ col * NTENS + row ] = value;
+                    symmetric_matrix[ row * NTENS + col ] = value;
+                }
+            }
+            source = symmetric_matrix;
+        }
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+            for ( unsigned int j = 0; j < 9; j++ ){
+                full_matrix[ 9 * i + j ] = ( ( fullIndex[ i ] < 0 ) || ( fullIndex[ j ] < 0 ) ) ?
+                                           T( 0 ) : static_cast< T >( source[ fullIndex[ j ] * NTENS + fullIndex[ i ] ] );
+            }
+        }
+
+    }
+
+    template< typename T, typename U >
+    inline void expandFullNTENSTensorBlock( T *full_block, const U *abaqus_block, const int &nblock,
+                                            const int &NDI, const int &NSHR, const bool abaqus_standard ){
+        /*!
+         * Expand a block of contracted Abaqus stress-type vectors, e.g. the VUMAT ``stressOld`` or ``strainInc``
+         * arrays, into a block of full 3x3 tensors.
+         *
+         * Both blocks are column major (Fortran) arrays with one row per material point, i.e. a structure-of-arrays
+         * layout where each component is contiguous across the block
+         *
+         *     abaqus_block[ component * nblock + k ], component in [0, NDI + NSHR)
+         *     full_block[ component * nblock + k ], component in [0, 9) of the row-major full tensor
+         *
+         * The conversion is a single pass of contiguous copies over ``nblock``. The Abaqus solver type has no default:
+         * the VUMAT is the primary source of blocked arrays, while the other converters default to Abaqus/Standard.
+         *
+         * The scalar types may differ, e.g. a single precision state block widened to double precision tensors. The
+         * contiguous copies are then vectorized widening conversions.
+         *
+         * \param *full_block: The pointer to the start of the nblock x 9 column major full tensor block
+         * \param *abaqus_block: The pointer to the start of the nblock x (NDI + NSHR) column major Abaqus block
+         * \param &nblock: The number of material points in the block
+         * \param &NDI: The number of direct components, e.g. the VUMAT ``ndir``.
+         * \param &NSHR: The number of shear components, e.g. the VUMAT ``nshr``.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensorBlock,
+                                            nblock * ( ( NDI + NSHR ) * sizeof( U ) + 9 * sizeof( T ) ) );
+
+        checkNTENS( NDI, NSHR );
+
+        //Set the tensor packing order by Abaqus solver
+        const std::array< unsigned int, 9 > &tensorOrder = expandOrder( abaqusSolver( abaqus_standard ) );
+
+        for ( unsigned int component = 0; component < 9; component++ ){
+            T *full_column = full_block + component * nblock;
+            const int index = contractedIndex( tensorOrder[ component ], NDI, NSHR );
+            if ( index < 0 ){
+                for ( int k = 0; k < nblock; k++ ){
+                    full_column[ k ] = 0;
+                }
+            }
+            else{
+                const U *abaqus_column = abaqus_block + index * nblock;
+                for ( int k = 0; k < nblock; k++ ){
+                    full_column[ k ] = static_cast< T >( abaqus_column[ k ] );
+                }
+            }
+        }
+
+    }
+
+    template< typename T, typename U >
+    inline void contractFullNTENSTensorBlock( T *abaqus_block, const U *full_block, const int &nblock,
+                                              const int &NDI, const int &NSHR, const bool abaqus_standard ){
+        /*!
+         * Contract a block of full 3x3 tensors into a block of contracted Abaqus stress-type vectors, e.g. the VUMAT
+         * ``stressNew`` array.
+         *
+         * See ``tardigradeAbaqusTools::expandFullNTENSTensorBlock`` for the block layouts. The scalar types may differ,
+         * e.g. double precision tensors narrowed into a single precision state block.
+         *
+         * \param *abaqus_block: The pointer to the start of the nblock x (NDI + NSHR) column major Abaqus block
+         * \param *full_block: The pointer to the start of the nblock x 9 column major full tensor block
+         * \param &nblock: The number of material points in the block
+         * \param &NDI: The number of direct components, e.g. the VUMAT ``ndir``.
+         * \param &NSHR: The number of shear components, e.g. the VUMAT ``nshr``.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSTensorBlock,
+                                            nblock * ( ( NDI + NSHR ) * sizeof( T ) + 9 * sizeof( U ) ) );
+
+        checkNTENS( NDI, NSHR );
+
+        //Set the tensor unpacking order by Abaqus solver
+        const std::array< unsigned int, 6 > &tensorOrder = contractOrder( abaqusSolver( abaqus_standard ) );
+
+        for ( int index = 0; index < NDI + NSHR; index++ ){
+            T *abaqus_column = abaqus_block + index * nblock;
+            const U *full_column = full_block + tensorOrder[ expandedIndex( index, NDI ) ] * nblock;
+            for ( int k = 0; k < nblock; k++ ){
+                abaqus_column[ k ] = static_cast< T >( full_column[ k ] );
+            }
+        }
+
+    }
+
+    //! Instruction sets available to the batched packing kernels
+    enum class SIMDLevel{
+        Scalar, //!< Portable scalar loops
+        AVX2,   //!< 256 bit AVX2 shuffles
+        AVX512  //!< 512 bit AVX-512F shuffles
+    };
+
+    inline SIMDLevel detectSIMDLevel( ){
+        /*!
+         * Detect the widest instruction set supported by the running CPU. The detection runs once per process.
+         *
+         * \returns simd_level: The widest supported instruction set
+         */
+#ifdef TARDIGRADE_ABAQUS_TOOLS_X86_SIMD
+        static const SIMDLevel simd_level = __builtin_cpu_supports( "avx512f" ) ? SIMDLevel::AVX512 :
+                                            __builtin_cpu_supports( "avx2" ) ? SIMDLevel::AVX2 : SIMDLevel::Scalar;
+        return simd_level;
+#else
+        return SIMDLevel::Scalar;
+#endif
+    }
+
+    inline SIMDLevel supportedSIMDLevel( const SIMDLevel simd_level ){
+        /*!
+         * Clamp a requested instruction set to the instruction sets supported by the running CPU, so that requesting a
+         * wider instruction set falls back instead of executing illegal instructions.
+         *
+         * \param simd_level: The requested instruction set
+         * \returns The narrower of the requested and the widest supported instruction set
+         */
+        return std::min( simd_level, detectSIMDLevel( ) );
+    }
+
+    template< std::size_t INPUT_SIZE, typename T, typename U, std::size_t OUTPUT_SIZE >
+    inline void permuteBatchScalar( T *output, const U *input, const int &npoints,
+                                    const std::array< unsigned int, OUTPUT_SIZE > &order ){
+        /*!
+         * Apply an index permutation to every point of an array-of-structures batch with scalar loops, converting each
+         * component to the output scalar type
+         *
+         * \param *output: The pointer to the start of the npoints x OUTPUT_SIZE row major output batch
+         * \param *input: The pointer to the start of the npoints x INPUT_SIZE row major input batch
+         * \param &npoints: The number of points in the batch
+         * \param &order: The input index of each output component
+         */
+        for ( int point = 0; point < npoints; point++ ){
+            const U *input_point = input + INPUT_SIZE * point;
+            T *output_point = output + OUTPUT_SIZE * point;
+            for ( std::size_t index = 0; index < OUTPUT_SIZE; index++ ){
+                output_point[ index ] = static_cast< T >( input_point[ order[ index ] ] );
+            }
+        }
+    }
+
+    //! Scalar types supported by the widening and narrowing SIMD kernels
+    template< typename T >
+    constexpr bool isSIMDScalar = std::is_same< T, float >::value || std::is_same< T, double >::value;
+
+#ifdef TARDIGRADE_ABAQUS_TOOLS_X86_SIMD
+    __attribute__(( target( "avx2" ) ))
+    inline __m256d avx2Load( const double *input ){
+        /*!
+         * Load four double precision values
+         *
+         * \param *input: The pointer to the first value
+         */
+        return _mm256_loadu_pd( input );
+    }
+
+    __attribute__(( target( "avx2" ) ))
+    inline __m256d avx2Load( const float *input ){
+        /*!
+         * Load four single precision values widened to double precision
+         *
+         * \param *input: The pointer to the first value
+         */
+        return _mm256_cvtps_pd( _mm_loadu_ps( input ) );
+    }
+
+    __attribute__(( target( "avx2" ) ))
+    inline void avx2Store( double *output, const __m256d value ){
+        /*!
+         * Store four double precision values
+         *
+         * \param *output: The pointer to the first value
+         * \param value: The values to store
+         */
+        _mm256_storeu_pd( output, value );
+    }
+
+    __attribute__(( target( "avx2" ) ))
+    inline void avx2Store( float *output, const __m256d value ){
+        /*!
+         * Store four double precision values narrowed to single precision with the current rounding mode
+         *
+         * \param *output: The pointer to the first value
+         * \param value: The values to store
+         */
+        _mm_storeu_ps( output, _mm256_cvtpd_ps( value ) );
+    }
+
+    struct AVX2Shuffle{
+        /*!
+         * Immediate operands that gather four double precision output lanes from a ``low`` register holding source
+         * lanes [0, 4), a ``high`` register holding source lanes [offset, offset + 4), and a broadcast of source lane 8
+         */
+        int low;   //!< ``_mm256_permute4x64_pd`` immediate for the low register
+        int high;  //!< ``_mm256_permute4x64_pd`` immediate for the high register
+        int blend; //!< ``_mm256_blend_pd`` immediate selecting the permuted high register
+        int last;  //!< ``_mm256_blend_pd`` immediate selecting the broadcast of source lane 8
+    };
+
+    template< std::size_t N >
+    constexpr AVX2Shuffle avx2Shuffle( const std::array< unsigned int, N > &order, const unsigned int &first,
+                                       const unsigned int &offset ){
+        /*!
+         * Compute the AVX2 shuffle immediates for the four output lanes starting at ``first``
+         *
+         * \param &order: The source lane of each output lane
+         * \param &first: The first output lane of the group
+         * \param &offset: The first source lane of the high register
+         */
+        AVX2Shuffle shuffle = { 0, 0, 0, 0 };
+        for ( unsigned int lane = 0; lane < 4; lane++ ){
+            const unsigned int source = order[ first + lane ];
+            if ( source < 4 ){
+                shuffle.low |= source << ( 2 * lane );
+            }
+            else if ( source < offset + 4 ){
+                shuffle.high |= ( source - offset ) << ( 2 * lane );
+                shuffle.blend |= 1 << lane;
+            }
+            else{
+                shuffle.last |= 1 << lane;
+            }
+        }
+        return shuffle;
+    }
+
+    template< bool ABAQUS_STANDARD, typename T, typename U >
+    __attribute__(( target( "avx2" ) ))
+    inline void expandFullNTENSTensorBatchAVX2( T *full_tensors, const U *long_vectors, const int &npoints ){
+        /*!
+         * AVX2 kernel for ``tardigradeAbaqusTools::expandFullNTENSTensorBatch``. The expanded vector is held in the
+         * overlapping registers ``low = v[0:4]`` and ``high = v[2:6]`` and each group of four output lanes is an
+         * immediate permute of both registers followed by an immediate blend. Single precision batches are widened on
+         * load and narrowed on store.
+         *
+         * \param ABAQUS_STANDARD: True for the Abaqus/Standard packing order; False for Abaqus/Explicit
+         * \param *full_tensors: The pointer to the start of the npoints x 9 row major output batch
+         * \param *long_vectors: The pointer to the start of the npoints x 6 row major input batch
+         * \param &npoints: The number of points in the batch
+         */
+        constexpr const std::array< unsigned int, 9 > &order = expandOrder( abaqusSolver( ABAQUS_STANDARD ) );
+        constexpr AVX2Shuffle first = avx2Shuffle( order, 0, 2 );
+        constexpr AVX2Shuffle second = avx2Shuffle( order, 4, 2 );
+        for ( int point = 0; point < npoints; point++ ){
+            const U *input = long_vectors + 6 * point;
+            T *output = full_tensors + 9 * point;
+            const __m256d low = avx2Load( input );
+            const __m256d high = avx2Load( input + 2 );
+            avx2Store( output, _mm256_blend_pd( _mm256_permute4x64_pd( low, first.low ),
+                                                _mm256_permute4x64_pd( high, first.high ), first.blend ) );
+            avx2Store( output + 4, _mm256_blend_pd( _mm256_permute4x64_pd( low, second.low ),
+                                                    _mm256_permute4x64_pd( high, second.high ), second.blend ) );
+            output[ 8 ] = static_cast< T >( input[ order[ 8 ] ] );
+        }
+    }
+
+    template< bool ABAQUS_STANDARD, typename T, typename U >
+    __attribute__(( target( "avx2" ) ))
+    inline void contractFullNTENSTensorBatchAVX2( T *long_vectors, const U *full_tensors, const int &npoints ){
+        /*!
+         * AVX2 kernel for ``tardigradeAbaqusTools::contractFullNTENSTensorBatch``. The first four expanded vector
+         * components are immediate permutes and blends of the registers ``low = t[0:4]``, ``high = t[4:8]`` and a
+         * broadcast of ``t[8]``. The remaining two components are direct moves. Single precision batches are widened
+         * on load and narrowed on store.
+         *
+         * \param ABAQUS_STANDARD: True for the Abaqus/Standard packing order; False for Abaqus/Explicit
+         * \param *long_vectors: The pointer to the start of the npoints x 6 row major output batch
+         * \param *full_tensors: The pointer to the start of the npoints x 9 row major input batch
+         * \param &npoints: The number of points in the batch
+         */
+        constexpr const std::array< unsigned int, 6 > &order = contractOrder( abaqusSolver( ABAQUS_STANDARD ) );
+        constexpr AVX2Shuffle first = avx2Shuffle( order, 0, 4 );
+        for ( int point = 0; point < npoints; point++ ){
+            const U *input = full_tensors + 9 * point;
+            T *output = long_vectors + 6 * point;
+            const __m256d low = avx2Load( input );
+            const __m256d high = avx2Load( input + 4 );
+            const __m256d last = _mm256_set1_pd( input[ 8 ] );
+            avx2Store( output, _mm256_blend_pd( _mm256_blend_pd( _mm256_permute4x64_pd( low, first.low ),
+                                                                 _mm256_permute4x64_pd( high, first.high ),
+                                                                 first.blend ),
+                                                last, first.last ) );
+            output[ 4 ] = static_cast< T >( input[ order[ 4 ] ] );
+            output[ 5 ] = static_cast< T >( input[ order[ 5 ] ] );
+        }
+    }
+
+    __attribute__(( target( "avx512f" ) ))
+    inline void expandFullNTENSTensorBatchAVX512( double *full_tensors, const double *long_vectors, const int &npoints,
+                                                  const std::array< unsigned int, 9 > &order ){
+        /*!
+         * AVX-512 kernel for ``tardigradeAbaqusTools::expandFullNTENSTensorBatch``. The expanded vector is loaded into a
+         * single register and the first eight full tensor components are one lane permute.
+         *
+         * \param *full_tensors: The pointer to the start of the npoints x 9 row major output batch
+         * \param *long_vectors: The pointer to the start of the npoints x 6 row major input batch
+         * \param &npoints: The number of points in the batch
+         * \param &order: The expanded vector index of each full tensor component
+         */
+        const __m512i index = _mm512_setr_epi64( order[ 0 ], order[ 1 ], order[ 2 ], order[ 3 ],
+                                                 order[ 4 ], order[ 5 ], order[ 6 ], order[ 7 ] );
+        for ( int point = 0; point < npoints; point++ ){
+            const double *input = long_vectors + 6 * point;
+            double *output = full_tensors + 9 * point;
+            const __m512d vector = _mm512_maskz_loadu_pd( 0x3F, input );
+            _mm512_storeu_pd( output, _mm512_maskz_permutexvar_pd( 0xFF, index, vector ) );
+            output[ 8 ] = input[ order[ 8 ] ];
+        }
+    }
+
+    __attribute__(( target( "avx512f" ) ))
+    inline void contractFullNTENSTensorBatchAVX512( double *long_vectors, const double *full_tensors, const int &npoints,
+                                                    const std::array< unsigned int, 6 > &order ){
+        /*!
+         * AVX-512 kernel for ``tardigradeAbaqusTools::contractFullNTENSTensorBatch``. The nine full tensor components
+         * span two registers and the expanded vector is one two-source lane permute.
+         *
+         * \param *long_vectors: The pointer to the start of the npoints x 6 row major output batch
+         * \param *full_tensors: The pointer to the start of the npoints x 9 row major input batch
+         * \param &npoints: The number of points in the batch
+         * \param &order: The full tensor index of each expanded vector component
+         */
+        const __m512i index = _mm512_setr_epi64( order[ 0 ], order[ 1 ], order[ 2 ], order[ 3 ], order[ 4 ], order[ 5 ], 0, 0 );
+        for ( int point = 0; point < npoints; point++ ){
+            const double *input = full_tensors + 9 * point;
+            const __m512d low = _mm512_loadu_pd( input );
+            const __m512d high = _mm512_maskz_loadu_pd( 0x01, input + 8 );
+            _mm512_mask_storeu_pd( long_vectors + 6 * point, 0x3F, _mm512_permutex2var_pd( low, index, high ) );
+        }
+    }
+
+    __attribute__(( target( "avx2" ) ))
+    inline int convertPrecisionAVX2( double *output, const float *input, const int &size ){
+        /*!
+         * AVX2 kernel for ``tardigradeAbaqusTools::convertPrecision``. Widens four values per instruction.
+         *
+         * \param *output: The pointer to the start of the double precision output array
+         * \param *input: The pointer to the start of the single precision input array
+         * \param &size: The number of values
+         * \returns The number of values converted. The remainder is left to the scalar loop.
+         */
+        int index = 0;
+        for ( ; index + 4 <= size; index += 4 ){
+            _mm256_storeu_pd( output + index, _mm256_cvtps_pd( _mm_loadu_ps( input + index ) ) );
+        }
+        return index;
+    }
+
+    __attribute__(( target( "avx2" ) ))
+    inline int convertPrecisionAVX2( float *output, const double *input, const int &size ){
+        /*!
+         * AVX2 kernel for ``tardigradeAbaqusTools::convertPrecision``. Narrows four values per instruction.
+         *
+         * \param *output: The pointer to the start of the single precision output array
+         * \param *input: The pointer to the start of the double precision input array
+         * \param &size: The number of values
+         * \returns The number of values converted. The remainder is left to the scalar loop.
+         */
+        int index = 0;
+        for ( ; index + 4 <= size; index += 4 ){
+            _mm_storeu_ps( output + index, _mm256_cvtpd_ps( _mm256_loadu_pd( input + index ) ) );
+        }
+        return index;
+    }
+
+    __attribute__(( target( "avx512f" ) ))
+    inline int convertPrecisionAVX512( double *output, const float *input, const int &size ){
+        /*!
+         * AVX-512 kernel for ``tardigradeAbaqusTools::convertPrecision``. Widens eight values per instruction.
+         *
+         * \param *output: The pointer to the start of the double precision output array
+         * \param *input: The pointer to the start of the single precision input array
+         * \param &size: The number of values
+         * \returns The number of values converted. The remainder is left to the scalar loop.
+         */
+        int index = 0;
+        for ( ; index + 8 <= size; index += 8 ){
+            //The zero masked form avoids the undefined pass-through operand of the unmasked intrinsic
+            _mm512_storeu_pd( output + index, _mm512_maskz_cvtps_pd( 0xFF, _mm256_loadu_ps( input + index ) ) );
+        }
+        return index;
+    }
+
+    __attribute__(( target( "avx512f" ) ))
+    inline int convertPrecisionAVX512( float *output, const double *input, const int &size ){
+        /*!
+         * AVX-512 kernel for ``tardigradeAbaqusTools::convertPrecision``. Narrows eight values per instruction.
+         *
+         * \param *output: The pointer to the start of the single precision output array
+         * \param *input: The pointer to the start of the double precision input array
+         * \param &size: The number of values
+         * \returns The number of values converted. The remainder is left to the scalar loop.
+         */
+        int index = 0;
+        for ( ; index + 8 <= size; index += 8 ){
+            //The zero masked form avoids the undefined pass-through operand of the unmasked intrinsic
+            _mm256_storeu_ps( output + index, _mm512_maskz_cvtpd_ps( 0xFF, _mm512_loadu_pd( input + index ) ) );
+        }
+        return index;
+    }
+#endif
+
+    template< typename T, typename U >
+    inline void expandFullNTENSTensorBatch( T *full_tensors, const U *long_vectors, const int &npoints,
+                                            const bool abaqus_standard = true,
+                                            const SIMDLevel simd_level = detectSIMDLevel( ) ){
+        /*!
+         * Expand a batch of expanded Abaqus stress-type vectors of length 6 into full 3x3 tensors. The batch is stored
+         * as an array-of-structures, i.e. each point's components are contiguous, e.g. a Fortran ``STRESS(6, NPT)``
+         * array.
+         *
+         * Double precision batches use AVX2 or AVX-512 shuffle kernels when supported by the running CPU. Mixed single
+         * and double precision batches use the AVX2 kernels with widening loads and narrowing stores. The kernels only
+         * move and convert data and are bitwise identical to the scalar path.
+         *
+         * \param *full_tensors: The pointer to the start of the npoints x 9 row major output batch
+         * \param *long_vectors: The pointer to the start of the npoints x 6 row major input batch
+         * \param &npoints: The number of points in the batch
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \param simd_level: The instruction set to use, clamped to the instruction sets supported by the CPU. Default:
+         *     the widest instruction set supported by the CPU.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensorBatch, npoints * ( 9 * sizeof( T ) + 6 * sizeof( U ) ) );
+
+        //Set the tensor packing order by Abaqus solver
+        const std::array< unsigned int, 9 > &tensorOrder = expandOrder( abaqusSolver( abaqus_standard ) );
+
+#ifdef TARDIGRADE_ABAQUS_TOOLS_X86_SIMD
+        const SIMDLevel level = supportedSIMDLevel( simd_level );
+        if constexpr ( std::is_same< T, double >::value && std::is_same< U, double >::value ){
+            if ( level == SIMDLevel::AVX512 ){
+                expandFullNTENSTensorBatchAVX512( full_tensors, long_vectors, npoints, tensorOrder );
+                return;
+            }
+        }
+        if constexpr ( isSIMDScalar< T > && isSIMDScalar< U > ){
+            if ( level != SIMDLevel::Scalar ){
+                abaqus_standard ? expandFullNTENSTensorBatchAVX2< true >( full_tensors, long_vectors, npoints ) :
+                                  expandFullNTENSTensorBatchAVX2< false >( full_tensors, long_vectors, npoints );
+                return;
+            }
+        }
+#endif
+
+        permuteBatchScalar< 6 >( full_tensors, long_vectors, npoints, tensorOrder );
+
+    }
+
+    template< typename T, typename U >
+    inline void contractFullNTENSTensorBatch( T *long_vectors, const U *full_tensors, const int &npoints,
+                                              const bool abaqus_standard = true,
+                                              const SIMDLevel simd_level = detectSIMDLevel( ) ){
+        /*!
+         * Contract a batch of full 3x3 tensors stored as row-major vectors into expanded Abaqus stress-type vectors of
+         * length 6. The batch is stored as an array-of-structures, i.e. each point's components are contiguous.
+         *
+         * Double precision batches use AVX2 or AVX-512 shuffle kernels when supported by the running CPU. Mixed single
+         * and double precision batches use the AVX2 kernels with widening loads and narrowing stores. The kernels only
+         * move and convert data and are bitwise identical to the scalar path.
+         *
+         * \param *long_vectors: The pointer to the start of the npoints x 6 row major output batch
+         * \param *full_tensors: The pointer to the start of the npoints x 9 row major input batch
+         * \param &npoints: The number of points in the batch
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \param simd_level: The instruction set to use, clamped to the instruction sets supported by the CPU. Default:
+         *     the widest instruction set supported by the CPU.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSTensorBatch, npoints * ( 6 * sizeof( T ) + 9 * sizeof( U ) ) );
+
+        //Set the tensor unpacking order by Abaqus solver
+        const std::array< unsigned int, 6 > &tensorOrder = contractOrder( abaqusSolver( abaqus_standard ) );
+
+#ifdef TARDIGRADE_ABAQUS_TOOLS_X86_SIMD
+        const SIMDLevel level = supportedSIMDLevel( simd_level );
+        if constexpr ( std::is_same< T, double >::value && std::is_same< U, double >::value ){
+            if ( level == SIMDLevel::AVX512 ){
+                contractFullNTENSTensorBatchAVX512( long_vectors, full_tensors, npoints, tensorOrder );
+                return;
+            }
+        }
+        if constexpr ( isSIMDScalar< T > && isSIMDScalar< U > ){
+            if ( level != SIMDLevel::Scalar ){
+                abaqus_standard ? contractFullNTENSTensorBatchAVX2< true >( long_vectors, full_tensors, npoints ) :
+                                  contractFullNTENSTensorBatchAVX2< false >( long_vectors, full_tensors, npoints );
+                return;
+            }
+        }
+#endif
+
+        permuteBatchScalar< 9 >( long_vectors, full_tensors, npoints, tensorOrder );
+
+    }
+
+    template< typename T, typename U >
+    inline void convertPrecision( T *output, const U *input, const int &size,
+                                  const SIMDLevel simd_level = detectSIMDLevel( ) ){
+        /*!
+         * Convert an array between scalar types, e.g. widen a single precision ``STATEV`` array to double precision
+         * before the constitutive update and narrow the result on the way back.
+         *
+         * Conversions between single and double precision use AVX2 or AVX-512 kernels when supported by the running
+         * CPU. Narrowing rounds to nearest, identical to ``static_cast``.
+         *
+         * \param *output: The pointer to the start of the output array
+         * \param *input: The pointer to the start of the input array
+         * \param &size: The number of values
+         * \param simd_level: The instruction set to use, clamped to the instruction sets supported by the CPU. Default:
+         *     the widest instruction set supported by the CPU.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( convertPrecision, size * ( sizeof( T ) + sizeof( U ) ) );
+
+        int index = 0;
+
+#ifdef TARDIGRADE_ABAQUS_TOOLS_X86_SIMD
+        if constexpr ( isSIMDScalar< T > && isSIMDScalar< U > && !std::is_same< T, U >::value ){
+            const SIMDLevel level = supportedSIMDLevel( simd_level );
+            if ( level == SIMDLevel::AVX512 ){
+                index = convertPrecisionAVX512( output, input, size );
+            }
+            else if ( level == SIMDLevel::AVX2 ){
+                index = convertPrecisionAVX2( output, input, size );
+            }
+        }
+#endif
+
+        for ( ; index < size; index++ ){
+            output[ index ] = static_cast< T >( input[ index ] );
+        }
+
+    }
+
+    template< int NDI, int NSHR >
+    constexpr void checkNTENSTemplate( ){
+        /*!
+         * Compile time checks for the number of direct and shear components
+         *
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         */
+        static_assert( NDI >= 1 && NDI <= 3, "NDI must be in the range [1, 3]" );
+        static_assert( NSHR >= 0 && NSHR <= 3, "NSHR must be in the range [0, 3]" );
+    }
+
+    template< int NDI, int NSHR, class Vector >
+    inline std::array< ScalarType< Vector >, 6 > expandAbaqusNTENSVector( const Vector &abaqus_vector ){
+        /*!
+         * Expand stress and strain type components to full Abaqus vectors with compile time NDI and NSHR. The
+         * component loops are fully unrolled.
+         *
+         * See the ``std::vector`` overload for the Abaqus component ordering.
+         *
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param &abaqus_vector: an abaqus stress-type vector with no by-definition-zero components. Any indexable type,
+         *     e.g. the ``STRESS`` pointer, ``std::vector``, ``std::array``, or ``ColumnMajorView``. Length NDI + NSHR.
+         * \returns vector_expansion: c++ type array of length 6.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandAbaqusNTENSVector,
+                                            ( NDI + NSHR + 6 ) * sizeof( ScalarType< Vector > ) );
+
+        checkNTENSTemplate< NDI, NSHR >( );
+
+        //Initialize expanded vector with zero values
+        std::array< ScalarType< Vector >, 6 > vector_expansion = { };
+
+        //Unpack direct components of Abaqus/Standard stress-type vector
+        for ( int index = 0; index < NDI; index++ ){
+            vector_expansion[ index ] = abaqus_vector[ index ];
+        }
+
+        //Unpack shear components of Abaqus/Standard stress-type vector
+        for ( int index = 0; index < NSHR; index++ ){
+            vector_expansion[ 3 + index ] = abaqus_vector[ NDI + index ];
+        }
+
+        return vector_expansion;
+    }
+
+    template< int NDI, int NSHR, class Vector >
+    inline std::array< ScalarType< Vector >, NDI + NSHR > contractAbaqusNTENSVector( const Vector &full_abaqus_vector ){
+        /*!
+         * Contract stress and strain type components from full Abaqus vectors with compile time NDI and NSHR. The
+         * component loops are fully unrolled.
+         *
+         * See the ``std::vector`` overload for the Abaqus component ordering.
+         *
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param &full_abaqus_vector: a previously expanded abaqus stress-type vector. Length 6.
+         * \returns vector_contraction: c++ type array of length NDI + NSHR.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractAbaqusNTENSVector,
+                                            ( NDI + NSHR + 6 ) * sizeof( ScalarType< Vector > ) );
+
+        checkNTENSTemplate< NDI, NSHR >( );
+
+        std::array< ScalarType< Vector >, NDI + NSHR > vector_contraction;
+
+        //Pack non-zero direct components of Abaqus/Standard stress-type vector
+        for ( int index = 0; index < NDI; index++ ){
+            vector_contraction[ index ] = full_abaqus_vector[ index ];
+        }
+
+        //Pack non-zero shear components of Abaqus/Standard stress-type vector
+        for ( int index = 0; index < NSHR; index++ ){
+            vector_contraction[ NDI + index ] = full_abaqus_vector[ 3 + index ];
+        }
+
+        return vector_contraction;
+    }
+
+    template< int NDI, int NSHR, class Vector >
+    inline std::array< ScalarType< Vector >, 9 > expandFullNTENSTensor( const Vector &abaqus_vector,
+                                                                        const bool abaqus_standard = true ){
+        /*!
+         * Expand the full 3x3 tensor as a row-major array from the contracted Abaqus stress-type vector with compile
+         * time NDI and NSHR.
+         *
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param &abaqus_vector: an abaqus stress-type vector with no by-definition-zero components. Length NDI + NSHR.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns full_tensor: c++ type row-major array of length 9.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensor,
+                                            ( NDI + NSHR + 9 ) * sizeof( ScalarType< Vector > ) );
+
+        checkNTENSTemplate< NDI, NSHR >( );
+
+        return tardigradeAbaqusTools::lazyExpandFullNTENSTensor< NDI, NSHR >( abaqus_vector, abaqus_standard );
+
+    }
+
+    template< int NDI, int NSHR, class Vector >
+    inline std::array< ScalarType< Vector >, NDI + NSHR > contractFullNTENSTensor( const Vector &full_tensor,
+                                                                                   const bool abaqus_standard = true ){
+        /*!
+         * Contract a full 3x3 tensor stored as a row-major vector into an Abaqus stress-type vector with compile
+         * time NDI and NSHR.
+         *
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param &full_tensor: c++ type row-major vector of length 9.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns abaqus_vector: a contracted abaqus stress-type array. Length NDI + NSHR.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSTensor,
+                                            ( NDI + NSHR + 9 ) * sizeof( ScalarType< Vector > ) );
+
+        checkNTENSTemplate< NDI, NSHR >( );
+
+        std::array< ScalarType< Vector >, NDI + NSHR > abaqus_vector;
+        tardigradeAbaqusTools::lazyContractFullNTENSTensor< NDI, NSHR >( full_tensor, abaqus_standard ).evaluate( abaqus_vector );
+
+        return abaqus_vector;
+
+    }
+
+    template< AbaqusSolver SOLVER, class Vector >
+    inline std::array< ScalarType< Vector >, 9 > expandFullNTENSTensor( const Vector &long_vector ){
+        /*!
+         * Expand the full 3x3 tensor as a row-major array from an expanded Abaqus stress-type vector of length 6 with
+         * a compile time solver type. The packing order is a compile time constant, so the component loads use
+         * immediate offsets.
+         *
+         * \param SOLVER: The Abaqus solver type.
+         * \param &long_vector: The expanded Abaqus stress-type vector. Any indexable type of length 6.
+         * \returns full_tensor: c++ type row-major array of length 9.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensor, 15 * sizeof( ScalarType< Vector > ) );
+
+        constexpr const std::array< unsigned int, 9 > &tensorOrder = expandOrder( SOLVER );
+
+        std::array< ScalarType< Vector >, 9 > full_tensor;
+        for ( unsigned int index = 0; index < 9; index++ ){
+            full_tensor[ index ] = long_vector[ tensorOrder[ index ] ];
+        }
+
+        return full_tensor;
+    }
+
+    template< AbaqusSolver SOLVER, class Tensor >
+    inline std::array< ScalarType< Tensor >, 6 > contractFullNTENSTensor( const Tensor &full_tensor ){
+        /*!
+         * Contract a full 3x3 tensor stored as a row-major vector into an expanded Abaqus stress-type vector of length
+         * 6 with a compile time solver type.
+         *
+         * \param SOLVER: The Abaqus solver type.
+         * \param &full_tensor: c++ type row-major vector of length 9.
+         * \returns full_abaqus_vector: The expanded Abaqus stress-type array of length 6.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSTensor, 15 * sizeof( ScalarType< Tensor > ) );
+
+        constexpr const std::array< unsigned int, 6 > &tensorOrder = contractOrder( SOLVER );
+
+        std::array< ScalarType< Tensor >, 6 > full_abaqus_vector;
+        for ( unsigned int index = 0; index < 6; index++ ){
+            full_abaqus_vector[ index ] = full_tensor[ tensorOrder[ index ] ];
+        }
+
+        return full_abaqus_vector;
+    }
+
+    template< int NDI, int NSHR, AbaqusSolver SOLVER, class Vector >
+    inline std::array< ScalarType< Vector >, 9 > expandFullNTENSTensor( const Vector &abaqus_vector ){
+        /*!
+         * Expand the full 3x3 tensor as a row-major array from the contracted Abaqus stress-type vector with compile
+         * time NDI, NSHR, and solver type. The composite index map is a compile time constant.
+         *
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param SOLVER: The Abaqus solver type.
+         * \param &abaqus_vector: an abaqus stress-type vector with no by-definition-zero components. Length NDI + NSHR.
+         * \returns full_tensor: c++ type row-major array of length 9.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensor,
+                                            ( NDI + NSHR + 9 ) * sizeof( ScalarType< Vector > ) );
+
+        checkNTENSTemplate< NDI, NSHR >( );
+
+        constexpr const std::array< int, 9 > &index_map = fullTensorNTENSMap< NDI, NSHR, SOLVER == AbaqusSolver::Standard >;
+
+        std::array< ScalarType< Vector >, 9 > full_tensor;
+        for ( unsigned int index = 0; index < 9; index++ ){
+            full_tensor[ index ] = index_map[ index ] < 0 ? ScalarType< Vector >( 0 ) : abaqus_vector[ index_map[ index ] ];
+        }
+
+        return full_tensor;
+    }
+
+    template< int NDI, int NSHR, AbaqusSolver SOLVER, class Tensor >
+    inline std::array< ScalarType< Tensor >, NDI + NSHR > contractFullNTENSTensor( const Tensor &full_tensor ){
+        /*!
+         * Contract a full 3x3 tensor stored as a row-major vector into an Abaqus stress-type vector with compile time
+         * NDI, NSHR, and solver type. The composite index map is a compile time constant.
+         *
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param SOLVER: The Abaqus solver type.
+         * \param &full_tensor: c++ type row-major vector of length 9.
+         * \returns abaqus_vector: a contracted abaqus stress-type array. Length NDI + NSHR.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSTensor,
+                                            ( NDI + NSHR + 9 ) * sizeof( ScalarType< Tensor > ) );
+
+        checkNTENSTemplate< NDI, NSHR >( );
+
+        constexpr const std::array< unsigned int, 6 > &index_map = NTENSFullTensorMap< NDI, NSHR, SOLVER == AbaqusSolver::Standard >;
+
+        std::array< ScalarType< Tensor >, NDI + NSHR > abaqus_vector;
+        for ( int index = 0; index < NDI + NSHR; index++ ){
+            abaqus_vector[ index ] = full_tensor[ index_map[ index ] ];
+        }
+
+        return abaqus_vector;
+    }
+
+    template< AbaqusSolver SOLVER, typename T >
+    inline std::array< T, 36 > contractFullNTENSMatrix( const std::array< T, 81 > &full_matrix ){
+        /*!
+         * Contract a flat, row-major 9x9 matrix into a flat, row-major expanded (6x6) Abaqus NTENS matrix with a compile
+         * time solver type.
+         *
+         * \param SOLVER: The Abaqus solver type.
+         * \param &full_matrix: The flat, row-major 9x9 matrix.
+         * \returns full_abaqus_matrix: Flat, row-major expanded 6x6 Voigt matrix with Abaqus element ordering.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSMatrix, 117 * sizeof( T ) );
+
+        constexpr const std::array< unsigned int, 6 > &tensorOrder = contractOrder( SOLVER );
+
+        std::array< T, 36 > full_abaqus_matrix;
+        for ( unsigned int i = 0; i < 6; i++ ){
+            for ( unsigned int j = 0; j < 6; j++ ){
+                full_abaqus_matrix[ 6 * i + j ] = full_matrix[ 9 * tensorOrder[ i ] + tensorOrder[ j ] ];
+            }
+        }
+
+        return full_abaqus_matrix;
+    }
+
+    template< AbaqusSolver SOLVER, typename T >
+    inline std::array< T, 81 > expandFullNTENSMatrix( const std::array< T, 36 > &full_abaqus_matrix ){
+        /*!
+         * Expand a flat, row-major expanded (6x6) Abaqus NTENS matrix into a flat, row-major 9x9 matrix with a compile
+         * time solver type.
+         *
+         * \param SOLVER: The Abaqus solver type.
+         * \param &full_abaqus_matrix: Flat, row-major expanded 6x6 Voigt matrix with Abaqus element ordering.
+         * \returns full_matrix: The flat, row-major 9x9 matrix.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSMatrix, 117 * sizeof( T ) );
+
+        constexpr const std::array< unsigned int, 9 > &tensorOrder = expandOrder( SOLVER );
+
+        std::array< T, 81 > full_matrix;
+        for ( unsigned int i = 0; i < 9; i++ ){
+            for ( unsigned int j = 0; j < 9; j++ ){
+                full_matrix[ 9 * i + j ] = full_abaqus_matrix[ 6 * tensorOrder[ i ] + tensorOrder[ j ] ];
+            }
+        }
+
+        return full_matrix;
+    }
+
+    template< int NDI, int NSHR, AbaqusSolver SOLVER, typename T, typename U >
+    inline void contractFullNTENSMatrix( T *abaqus_matrix, const U *full_matrix ){
+        /*!
+         * Re-pack a flat, row-major 9x9 matrix directly into a column major (Fortran) NTENSxNTENS array, e.g. the
+         * ``DDSDDE`` pointer, with compile time NDI, NSHR, and solver type. The composite index map is a compile time
+         * constant.
+         *
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param SOLVER: The Abaqus solver type.
+         * \param *abaqus_matrix: The pointer to the start of the column major NTENSxNTENS array
+         * \param *full_matrix: The pointer to the start of the flat, row-major 9x9 matrix. Length 81.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSMatrix,
+                                            81 * sizeof( U ) + ( NDI + NSHR ) * ( NDI + NSHR ) * sizeof( T ) );
+
+        checkNTENSTemplate< NDI, NSHR >( );
+
+        constexpr int NTENS = NDI + NSHR;
+        constexpr const std::array< unsigned int, 6 > &fullIndex = NTENSFullTensorMap< NDI, NSHR, SOLVER == AbaqusSolver::Standard >;
+
+        for ( int col = 0; col < NTENS; col++ ){
+            for ( int row = 0; row < NTENS; row++ ){
+                abaqus_matrix[ col * NTENS + row ] = static_cast< T >( full_matrix[ 9 * fullIndex[ row ] + fullIndex[ col ] ] );
+            }
+        }
+    }
+
+    template< int NDI, int NSHR, AbaqusSolver SOLVER, typename T, typename U >
+    inline void expandFullNTENSMatrix( T *full_matrix, const U *abaqus_matrix ){
+        /*!
+         * Expand a column major (Fortran) NTENSxNTENS array, e.g. the ``DDSDDE`` pointer, directly into a flat,
+         * row-major 9x9 matrix with compile time NDI, NSHR, and solver type. The by-definition-zero components are
+         * zero.
+         *
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param SOLVER: The Abaqus solver type.
+         * \param *full_matrix: The pointer to the start of the flat, row-major 9x9 matrix. Length 81.
+         * \param *abaqus_matrix: The pointer to the start of the column major NTENSxNTENS array
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSMatrix,
+                                            81 * sizeof( T ) + ( NDI + NSHR ) * ( NDI + NSHR ) * sizeof( U ) );
+
+        checkNTENSTemplate< NDI, NSHR >( );
+
+        constexpr int NTENS = NDI + NSHR;
+        constexpr const std::array< int, 9 > &fullIndex = fullTensorNTENSMap< NDI, NSHR, SOLVER == AbaqusSolver::Standard >;
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+            for ( unsigned int j = 0; j < 9; j++ ){
+                full_matrix[ 9 * i + j ] = ( ( fullIndex[ i ] < 0 ) || ( fullIndex[ j ] < 0 ) ) ?
+                                           T( 0 ) : static_cast< T >( abaqus_matrix[ fullIndex[ j ] * NTENS + fullIndex[ i ] ] );
+            }
+        }
+    }
+
+    template< class Function >
+    inline decltype( auto ) dispatchNTENS( const int &NDI, const int &NSHR, Function &&function ){
+        /*!
+         * Map the runtime number of direct and shear components to the compile time specializations. The function is
+         * called with ``std::integral_constant< int, NDI >`` and ``std::integral_constant< int, NSHR >`` arguments, e.g.
+         *
+         *     tardigradeAbaqusTools::dispatchNTENS( NDI, NSHR, [ & ]( auto ndi, auto nshr ){
+         *         constexpr int ndi_value = decltype( ndi )::value;
+         *         constexpr int nshr_value = decltype( nshr )::value;
+         *         auto full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor< ndi_value, nshr_value >( STRESS );
+         *         ...
+         *     } );
+         *
+         * The supported combinations are
+         *
+         * * NDI = 3, NSHR = 3: three dimensional elements
+         * * NDI = 3, NSHR = 1: plane strain and axisymmetric elements
+         * * NDI = 2, NSHR = 1: plane stress elements
+         *
+         * Every specialization of the function must return the same type.
+         *
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param &&function: The generic callable to specialize
+         * \returns The return value of the specialized function
+         */
+        if ( NDI == 3 && NSHR == 3 ){
+            return function( std::integral_constant< int, 3 >( ), std::integral_constant< int, 3 >( ) );
+        }
+        else if ( NDI == 3 && NSHR == 1 ){
+            return function( std::integral_constant< int, 3 >( ), std::integral_constant< int, 1 >( ) );
+        }
+        else if ( NDI == 2 && NSHR == 1 ){
+            return function( std::integral_constant< int, 2 >( ), std::integral_constant< int, 1 >( ) );
+        }
+        throw std::invalid_argument( "Unsupported combination of NDI and NSHR. Use the runtime NDI and NSHR overloads." );
+    }
+
+    template< class Function >
+    inline decltype( auto ) dispatchSolver( const bool abaqus_standard, Function &&function ){
+        /*!
+         * Map the runtime ``abaqus_standard`` flag to the compile time solver type. The function is called with a
+         * ``std::integral_constant< AbaqusSolver, SOLVER >`` argument, e.g.
+         *
+         *     tardigradeAbaqusTools::dispatchSolver( abaqus_standard, [ & ]( auto solver ){
+         *         auto full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor< decltype( solver )::value >( stress );
+         *         ...
+         *     } );
+         *
+         * Every specialization of the function must return the same type.
+         *
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         * \param &&function: The generic callable to specialize
+         * \returns The return value of the specialized function
+         */
+        if ( abaqus_standard ){
+            return function( std::integral_constant< AbaqusSolver, AbaqusSolver::Standard >( ) );
+        }
+        return function( std::integral_constant< AbaqusSolver, AbaqusSolver::Explicit >( ) );
+    }
+
+    template< typename T >
+    constexpr T engineeringShearScale( const bool expand ){
+        /*!
+         * The factor between engineering and tensorial shear strains
+         *
+         * \param expand: True for the engineering to tensorial scaling of the expansions; False for the tensorial to
+         *     engineering scaling of the contractions.
+         * \returns The shear scaling factor
+         */
+        return expand ? T( 0.5 ) : T( 2 );
+    }
+
+    template< int NDI, int NSHR, AbaqusSolver SOLVER = AbaqusSolver::Standard, class Vector >
+    inline std::array< ScalarType< Vector >, 9 > expandFullNTENSStrain( const Vector &abaqus_vector ){
+        /*!
+         * Expand the full 3x3 strain tensor as a row-major array from the contracted Abaqus strain-type vector with
+         * engineering shear strains, e.g. the ``STRAN`` or ``DSTRAN`` pointer, with compile time NDI, NSHR, and solver
+         * type. The shear strains are halved in the same pass.
+         *
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param SOLVER: The Abaqus solver type. Default: Abaqus/Standard.
+         *     Abaqus/Explicit ordered vectors must also store engineering shear strains. The tensorial VUMAT
+         *     ``strainInc`` is expanded with ``expandFullNTENSTensor`` instead.
+         * \param &abaqus_vector: an abaqus strain-type vector with no by-definition-zero components. Length NDI + NSHR.
+         * \returns full_tensor: c++ type row-major array of length 9 with tensorial shear strains.
+         */
+
+        using T = ScalarType< Vector >;
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensor, ( NDI + NSHR + 9 ) * sizeof( T ) );
+
+        checkNTENSTemplate< NDI, NSHR >( );
+
+        constexpr const std::array< int, 9 > &index_map = fullTensorNTENSMap< NDI, NSHR, SOLVER == AbaqusSolver::Standard >;
+
+        std::array< T, 9 > full_tensor;
+        for ( unsigned int index = 0; index < 9; index++ ){
+            const T scale = index % 4 == 0 ? T( 1 ) : engineeringShearScale< T >( true );
+            full_tensor[ index ] = index_map[ index ] < 0 ? T( 0 ) : scale * abaqus_vector[ index_map[ index ] ];
+        }
+
+        return full_tensor;
+    }
+
+    template< int NDI, int NSHR, AbaqusSolver SOLVER = AbaqusSolver::Standard, class Tensor >
+    inline std::array< ScalarType< Tensor >, NDI + NSHR > contractFullNTENSStrain( const Tensor &full_tensor ){
+        /*!
+         * Contract a full 3x3 strain tensor with tensorial shear strains stored as a row-major vector into an Abaqus
+         * strain-type vector with engineering shear strains with compile time NDI, NSHR, and solver type. The shear
+         * strains are doubled in the same pass.
+         *
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param SOLVER: The Abaqus solver type. Default: Abaqus/Standard.
+         *     Abaqus/Explicit ordered vectors are written with engineering shear strains. Use
+         *     ``contractFullNTENSTensor`` for the tensorial VUMAT ``strainInc`` layout.
+         * \param &full_tensor: c++ type row-major vector of length 9.
+         * \returns abaqus_vector: a contracted abaqus strain-type array. Length NDI + NSHR.
+         */
+
+        using T = ScalarType< Tensor >;
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSTensor, ( NDI + NSHR + 9 ) * sizeof( T ) );
+
+        checkNTENSTemplate< NDI, NSHR >( );
+
+        constexpr const std::array< unsigned int, 6 > &index_map = NTENSFullTensorMap< NDI, NSHR, SOLVER == AbaqusSolver::Standard >;
+
+        std::array< T, NDI + NSHR > abaqus_vector;
+        for ( int index = 0; index < NDI + NSHR; index++ ){
+            const T scale = index < NDI ? T( 1 ) : engineeringShearScale< T >( false );
+            abaqus_vector[ index ] = scale * full_tensor[ index_map[ index ] ];
+        }
+
+        return abaqus_vector;
+    }
+
+    template< class Output, class Vector, typename = EnableIfVectorOutput< Output, Vector > >
+    inline void expandFullNTENSStrain( Output &&full_tensor, const Vector &abaqus_vector,
+                                       const int &NDI, const int &NSHR, const bool abaqus_standard = true ){
+        /*!
+         * Expand the full 3x3 strain tensor into a preallocated row-major vector from the contracted Abaqus strain-type
+         * vector with engineering shear strains, e.g. the ``STRAN`` or ``DSTRAN`` pointer. The shear strains are
+         * halved in the same pass.
+         *
+         * \param &&full_tensor: The destination row-major vector with tensorial shear strains. Length 9.
+         * \param &abaqus_vector: an abaqus strain-type vector with no by-definition-zero components. Length NDI + NSHR.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True. The Abaqus/Explicit ordering is only valid for engineering shear
+         *                         strains, not the tensorial VUMAT ``strainInc``.
+         */
+
+        using T = ScalarType< Vector >;
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensor, ( NDI + NSHR + 9 ) * sizeof( T ) );
+
+        checkSize( full_tensor, 9, "The full tensor must have 9 entries" );
+        checkSize( abaqus_vector, NDI + NSHR, "The abaqus vector must have NDI + NSHR entries" );
+
+        const std::array< int, 9 > index_map = fullTensorNTENSIndex( NDI, NSHR, abaqus_standard );
+
+        for ( unsigned int index = 0; index < 9; index++ ){
+            const T scale = index % 4 == 0 ? T( 1 ) : engineeringShearScale< T >( true );
+            full_tensor[ index ] = index_map[ index ] < 0 ? T( 0 ) : scale * abaqus_vector[ index_map[ index ] ];
+        }
+    }
+
+    template< class Output, class Tensor, typename = EnableIfVectorOutput< Output, Tensor > >
+    inline void contractFullNTENSStrain( Output &&abaqus_vector, const Tensor &full_tensor,
+                                         const int &NDI, const int &NSHR, const bool abaqus_standard = true ){
+        /*!
+         * Contract a full 3x3 strain tensor with tensorial shear strains stored as a row-major vector into a
+         * preallocated Abaqus strain-type vector with engineering shear strains. The shear strains are doubled in the
+         * same pass.
+         *
+         * \param &&abaqus_vector: The destination contracted abaqus strain-type vector. Length NDI + NSHR.
+         * \param &full_tensor: c++ type row-major vector of length 9.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True. The Abaqus/Explicit ordering is only valid for engineering shear
+         *                         strains, not the tensorial VUMAT ``strainInc``.
+         */
+
+        using T = ScalarType< Tensor >;
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSTensor, ( NDI + NSHR + 9 ) * sizeof( T ) );
+
+        checkSize( abaqus_vector, NDI + NSHR, "The abaqus vector must have NDI + NSHR entries" );
+        checkSize( full_tensor, 9, "The full tensor must have 9 entries" );
+
+        const std::array< unsigned int, 6 > index_map = NTENSFullTensorIndex( NDI, NSHR, abaqus_standard );
+
+        for ( int index = 0; index < NDI + NSHR; index++ ){
+            const T scale = index < NDI ? T( 1 ) : engineeringShearScale< T >( false );
+            abaqus_vector[ index ] = scale * full_tensor[ index_map[ index ] ];
+        }
+    }
+
+    template< typename T, typename U >
+    inline void expandFullNTENSStrainBlock( T *full_block, const U *abaqus_block, const int &nblock,
+                                            const int &NDI, const int &NSHR, const bool engineering_shear,
+                                            const bool abaqus_standard ){
+        /*!
+         * Expand a block of contracted Abaqus strain-type vectors into a block of full 3x3 tensors with tensorial shear
+         * strains. Engineering shear columns are halved in the same contiguous pass. The VUMAT ``strainInc`` array
+         * already stores tensorial shear strains and is expanded with ``engineering_shear = false``.
+         *
+         * See ``tardigradeAbaqusTools::expandFullNTENSTensorBlock`` for the block layouts.
+         *
+         * \param *full_block: The pointer to the start of the nblock x 9 column major full tensor block
+         * \param *abaqus_block: The pointer to the start of the nblock x (NDI + NSHR) column major Abaqus block
+         * \param &nblock: The number of material points in the block
+         * \param &NDI: The number of direct components, e.g. the VUMAT ``ndir``.
+         * \param &NSHR: The number of shear components, e.g. the VUMAT ``nshr``.
+         * \param engineering_shear: True if the Abaqus block stores engineering shear strains; False for tensorial
+         *     shear strains.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensorBlock,
+                                            nblock * ( ( NDI + NSHR ) * sizeof( U ) + 9 * sizeof( T ) ) );
+
+        checkNTENS( NDI, NSHR );
+
+        const std::array< int, 9 > index_map = fullTensorNTENSIndex( NDI, NSHR, abaqus_standard );
+
+        for ( unsigned int component = 0; component < 9; component++ ){
+            T *full_column = full_block + component * nblock;
+            if ( index_map[ component ] < 0 ){
+                for ( int k = 0; k < nblock; k++ ){
+                    full_column[ k ] = 0;
+                }
+            }
+            else{
+                const T scale = ( component % 4 == 0 ) || !engineering_shear ? T( 1 ) : engineeringShearScale< T >( true );
+                const U *abaqus_column = abaqus_block + index_map[ component ] * nblock;
+                for ( int k = 0; k < nblock; k++ ){
+                    full_column[ k ] = scale * static_cast< T >( abaqus_column[ k ] );
+                }
+            }
+        }
+
+    }
+
+    template< typename T, typename U >
+    inline void contractFullNTENSStrainBlock( T *abaqus_block, const U *full_block, const int &nblock,
+                                              const int &NDI, const int &NSHR, const bool engineering_shear,
+                                              const bool abaqus_standard ){
+        /*!
+         * Contract a block of full 3x3 tensors with tensorial shear strains into a block of contracted Abaqus
+         * strain-type vectors. Engineering shear columns are doubled in the same contiguous pass. Tensorial shear
+         * strains, e.g. for the VUMAT ``strainInc`` layout, are contracted with ``engineering_shear = false``.
+         *
+         * See ``tardigradeAbaqusTools::expandFullNTENSTensorBlock`` for the block layouts.
+         *
+         * \param *abaqus_block: The pointer to the start of the nblock x (NDI + NSHR) column major Abaqus block
+         * \param *full_block: The pointer to the start of the nblock x 9 column major full tensor block
+         * \param &nblock: The number of material points in the block
+         * \param &NDI: The number of direct components, e.g. the VUMAT ``ndir``.
+         * \param &NSHR: The number of shear components, e.g. the VUMAT ``nshr``.
+         * \param engineering_shear: True to store engineering shear strains in the Abaqus block; False for tensorial
+         *     shear strains.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSTensorBlock,
+                                            nblock * ( ( NDI + NSHR ) * sizeof( T ) + 9 * sizeof( U ) ) );
+
+        checkNTENS( NDI, NSHR );
+
+        const std::array< unsigned int, 6 > index_map = NTENSFullTensorIndex( NDI, NSHR, abaqus_standard );
+
+        for ( int index = 0; index < NDI + NSHR; index++ ){
+            const U scale = ( index < NDI ) || !engineering_shear ? U( 1 ) : engineeringShearScale< U >( false );
+            T *abaqus_column = abaqus_block + index * nblock;
+            const U *full_column = full_block + index_map[ index ] * nblock;
+            for ( int k = 0; k < nblock; k++ ){
+                abaqus_column[ k ] = static_cast< T >( scale * full_column[ k ] );
+            }
+        }
+
+    }
+
+    template< typename T, typename U >
+    inline void expandFullNTENSStrainBatch( T *full_tensors, const U *long_vectors, const int &npoints,
+                                            const bool abaqus_standard = true ){
+        /*!
+         * Expand a batch of expanded Abaqus strain-type vectors of length 6 with engineering shear strains into full
+         * 3x3 tensors with tensorial shear strains. The batch is stored as an array-of-structures, e.g. a Fortran
+         * ``STRAN(6, NPT)`` array. The shear strains are halved in the same pass.
+         *
+         * \param *full_tensors: The pointer to the start of the npoints x 9 row major output batch
+         * \param *long_vectors: The pointer to the start of the npoints x 6 row major input batch
+         * \param &npoints: The number of points in the batch
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True. The Abaqus/Explicit ordering is only valid for engineering shear
+         *                         strains, not the tensorial VUMAT ``strainInc``.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensorBatch, npoints * ( 9 * sizeof( T ) + 6 * sizeof( U ) ) );
+
+        dispatchSolver( abaqus_standard, [ & ]( auto solver ){
+            constexpr const std::array< unsigned int, 9 > &tensorOrder = expandOrder( decltype( solver )::value );
+            for ( int point = 0; point < npoints; point++ ){
+                T *full_tensor = full_tensors + 9 * point;
+                const U *long_vector = long_vectors + 6 * point;
+                for ( unsigned int index = 0; index < 9; index++ ){
+                    const T scale = index % 4 == 0 ? T( 1 ) : engineeringShearScale< T >( true );
+                    full_tensor[ index ] = scale * static_cast< T >( long_vector[ tensorOrder[ index ] ] );
+                }
+            }
+        } );
+
+    }
+
+    template< typename T, typename U >
+    inline void contractFullNTENSStrainBatch( T *long_vectors, const U *full_tensors, const int &npoints,
+                                              const bool abaqus_standard = true ){
+        /*!
+         * Contract a batch of full 3x3 tensors with tensorial shear strains stored as row-major vectors into expanded
+         * Abaqus strain-type vectors of length 6 with engineering shear strains. The batch is stored as an
+         * array-of-structures. The shear strains are doubled in the same pass.
+         *
+         * \param *long_vectors: The pointer to the start of the npoints x 6 row major output batch
+         * \param *full_tensors: The pointer to the start of the npoints x 9 row major input batch
+         * \param &npoints: The number of points in the batch
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True. The Abaqus/Explicit ordering is only valid for engineering shear
+         *                         strains, not the tensorial VUMAT ``strainInc``.
+         */
+
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSTensorBatch, npoints * ( 6 * sizeof( T ) + 9 * sizeof( U ) ) );
+
+        dispatchSolver( abaqus_standard, [ & ]( auto solver ){
+            constexpr const std::array< unsigned int, 6 > &tensorOrder = contractOrder( decltype( solver )::value );
+            for ( int point = 0; point < npoints; point++ ){
+                T *long_vector = long_vectors + 6 * point;
+                const U *full_tensor = full_tensors + 9 * point;
+                for ( unsigned int index = 0; index < 6; index++ ){
+                    const U scale = index < 3 ? U( 1 ) : engineeringShearScale< U >( false );
+                    long_vector[ index ] = static_cast< T >( scale * full_tensor[ tensorOrder[ index ] ] );
+                }
+            }
+        } );
+
+    }
+
+    constexpr std::array< int, 6 > symmetricRotationColumns( const int &NDI, const int &NSHR, const bool abaqus_standard = true ){
+        /*!
+         * Map the six independent components of a symmetric tensor, in the order 11, 22, 33, 12, 13, 23 used by the
+         * rotation kernels, to the components of the contracted Abaqus vector.
+         *
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
+         *                         Default: True.
+         * \returns The contracted vector component of each symmetric component or -1 for the by-definition-zero
+         *     components
+         */
+        constexpr std::array< int, 9 > symmetric_index = { 0, 3, 4, 3, 1, 5, 4, 5, 2 };
+        const std::array< unsigned int, 6 > full_index = NTENSFullTensorIndex( NDI, NSHR, abaqus_standard );
+        std::array< int, 6 > columns = { -1, -1, -1, -1, -1, -1 };
+        for ( int component = 0; component < NDI + NSHR; component++ ){
+            columns[ symmetric_index[ full_index[ component ] ] ] = component;
+        }
+        return columns;
+    }
+
+    template< typename T, typename U >
+    inline void rotateSymmetric( T *symmetric, const U *rotation ){
+        /*!
+         * Rotate a symmetric second order tensor, ``A' = R A R^T``, stored as its six independent components in the
+         * order 11, 22, 33, 12, 13, 23. The product ``R A`` uses the symmetry of ``A``, and only the upper triangle of
+         * the result is formed, 45 multiplications instead of the 54 of two full 3x3 products.
+         *
+         * \param *symmetric: The six independent tensor components. Overwritten with the rotated components.
+         * \param *rotation: The column major (Fortran) 3x3 rotation, e.g. the UMAT ``DROT`` pointer. R_ij is
+         *     ``rotation[ i + 3 * j ]``.
+         */
+        const T a11 = symmetric[ 0 ], a22 = symmetric[ 1 ], a33 = symmetric[ 2 ];
+        const T a12 = symmetric[ 3 ], a13 = symmetric[ 4 ], a23 = symmetric[ 5 ];
+        const T r11 = rotation[ 0 ], r21 = rotation[ 1 ], r31 = rotation[ 2 ];
+        const T r12 = rotation[ 3 ], r22 = rotation[ 4 ], r32 = rotation[ 5 ];
+        const T r13 = rotation[ 6 ], r23 = rotation[ 7 ], r33 = rotation[ 8 ];
+
+        // B = R A
+        const T b11 = r11 * a11 + r12 * a12 + r13 * a13;
+        const T b12 = r11 * a12 + r12 * a22 + r13 * a23;
+        const T b13 = r11 * a13 + r12 * a23 + r13 * a33;
+        const T b21 = r21 * a11 + r22 * a12 + r23 * a13;
+        const T b22 = r21 * a12 + r22 * a22 + r23 * a23;
+        const T b23 = r21 * a13 + r22 * a23 + r23 * a33;
+        const T b31 = r31 * a11 + r32 * a12 + r33 * a13;
+        const T b32 = r31 * a12 + r32 * a22 + r33 * a23;
+        const T b33 = r31 * a13 + r32 * a23 + r33 * a33;
+
+        // A' = B R^T, upper triangle
+        symmetric[ 0 ] = b11 * r11 + b12 * r12 + b13 * r13;
+        symmetric[ 1 ] = b21 * r21 + b22 * r22 + b23 * r23;
+        symmetric[ 2 ] = b31 * r31 + b32 * r32 + b33 * r33;
+        symmetric[ 3 ] = b11 * r21 + b12 * r22 + b13 * r23;
+        symmetric[ 4 ] = b11 * r31 + b12 * r32 + b13 * r33;
+        symmetric[ 5 ] = b21 * r31 + b22 * r32 + b23 * r33;
+    }
+
+    template< typename T, typename U >
+    inline void rotateNTENSComponents( T *abaqus_vector, const U *rotation, const std::array< int, 6 > &columns,
+                                       const bool strain ){
+        /*!
+         * Rotate one contracted vector in place through its symmetric rotation columns
+         *
+         * \param *abaqus_vector: The contracted vector
+         * \param *rotation: The column major 3x3 rotation
+         * \param &columns: The contracted vector component of each symmetric component, see
+         *     ``symmetricRotationColumns``
+         * \param strain: True for strain-type vectors with engineering shear strains; False for stress-type vectors.
+         */
+        const T shear_scale = strain ? T( 0.5 ) : T( 1 );
+        const T shear_inverse = strain ? T( 2 ) : T( 1 );
+
+        T symmetric[ 6 ];
+        T rotation_values[ 9 ];
+        for ( int index = 0; index < 6; index++ ){
+            const T value = columns[ index ] < 0 ? T( 0 ) : abaqus_vector[ columns[ index ] ];
+            symmetric[ index ] = index < 3 ? value : shear_scale * value;
+        }
+        for ( int index = 0; index < 9; index++ ){
+            rotation_values[ index ] = static_cast< T >( rotation[ index ] );
+        }
+        rotateSymmetric( symmetric, rotation_values );
+        for ( int index = 0; index < 6; index++ ){
+            if ( columns[ index ] >= 0 ){
+                abaqus_vector[ columns[ index ] ] = index < 3 ? symmetric[ index ] : shear_inverse * symmetric[ index ];
+            }
+        }
+    }
+
+    //! Number of points rotated together by the block rotation kernels
+    constexpr int rotationTileSize = 16;
+
+    template< typename T, typename U >
+    inline void rotateNTENSTiles( T *abaqus_block, const U *rotation_block, const int &nblock,
+                                  const std::array< int, 6 > &columns, const bool strain ){
+        /*!
+         * Rotate a block of contracted vectors in place in tiles of ``rotationTileSize`` points. Each tile is copied into
+         * local structure-of-arrays buffers so that the rotation of the tile vectorizes across the points without
+         * aliasing checks between the block and rotation arrays. The points after the last full tile are rotated one
+         * at a time.
+         *
+         * \param *abaqus_block: The pointer to the start of the nblock x (NDI + NSHR) column major Abaqus block
+         * \param *rotation_block: The pointer to the start of the nblock x 9 column major rotation block
+         * \param &nblock: The number of material points in the block
+         * \param &columns: The contracted vector component of each symmetric component, see
+         *     ``symmetricRotationColumns``
+         * \param strain: True for strain-type vectors with engineering shear strains; False for stress-type vectors.
+         */
+        const T shear_scale = strain ? T( 0.5 ) : T( 1 );
+        const T shear_inverse = strain ? T( 2 ) : T( 1 );
+
+        const int tiled = nblock - nblock % rotationTileSize;
+        for ( int first = 0; first < tiled; first += rotationTileSize ){
+            T a[ 6 ][ rotationTileSize ];
+            T r[ 9 ][ rotationTileSize ];
+            for ( int index = 0; index < 6; index++ ){
+                if ( columns[ index ] < 0 ){
+                    std::fill( a[ index ], a[ index ] + rotationTileSize, T( 0 ) );
+                    continue;
+                }
+                const T scale = index < 3 ? T( 1 ) : shear_scale;
+                const T *column = abaqus_block + columns[ index ] * nblock + first;
+                for ( int k = 0; k < rotationTileSize; k++ ){
+                    a[ index ][ k ] = scale * column[ k ];
+                }
+            }
+            for ( int index = 0; index < 9; index++ ){
+                const U *column = rotation_block + index * nblock + first;
+                for ( int k = 0; k < rotationTileSize; k++ ){
+                    r[ index ][ k ] = static_cast< T >( column[ k ] );
+                }
+            }
+
+            for ( int k = 0; k < rotationTileSize; k++ ){
+                // B = R A
+                const T b11 = r[ 0 ][ k ] * a[ 0 ][ k ] + r[ 3 ][ k ] * a[ 3 ][ k ] + r[ 6 ][ k ] * a[ 4 ][ k ];
+                const T b12 = r[ 0 ][ k ] * a[ 3 ][ k ] + r[ 3 ][ k ] * a[ 1 ][ k ] + r[ 6 ][ k ] * a[ 5 ][ k ];
+                const T b13 = r[ 0 ][ k ] * a[ 4 ][ k ] + r[ 3 ][ k ] * a[ 5 ][ k ] + r[ 6 ][ k ] * a[ 2 ][ k ];
+                const T b21 = r[ 1 ][ k ] * a[ 0 ][ k ] + r[ 4 ][ k ] * a[ 3 ][ k ] + r[ 7 ][ k ] * a[ 4 ][ k ];
+                const T b22 = r[ 1 ][ k ] * a[ 3 ][ k ] + r[ 4 ][ k ] * a[ 1 ][ k ] + r[ 7 ][ k ] * a[ 5 ][ k ];
+                const T b23 = r[ 1 ][ k ] * a[ 4 ][ k ] + r[ 4 ][ k ] * a[ 5 ][ k ] + r[ 7 ][ k ] * a[ 2 ][ k ];
+                const T b31 = r[ 2 ][ k ] * a[ 0 ][ k ] + r[ 5 ][ k ] * a[ 3 ][ k ] + r[ 8 ][ k ] * a[ 4 ][ k ];
+                const T b32 = r[ 2 ][ k ] * a[ 3 ][ k ] + r[ 5 ][ k ] * a[ 1 ][ k ] + r[ 8 ][ k ] * a[ 5 ][ k ];
+                const T b33 = r[ 2 ][ k ] * a[ 4 ][ k ] + r[ 5 ][ k ] * a[ 5 ][ k ] + r[ 8 ][ k ] * a[ 2 ][ k ];
+
+                // A' = B R^T, upper triangle
+                a[ 0 ][ k ] = b11 * r[ 0 ][ k ] + b12 * r[ 3 ][ k ] + b13 * r[ 6 ][ k ];
+                a[ 1 ][ k ] = b21 * r[ 1 ][ k ] + b22 * r[ 4 ][ k ] + b23 * r[ 7 ][ k ];
+                a[ 2 ][ k ] = b31 * r[ 2 ][ k ] + b32 * r[ 5 ][ k ] + b33 * r[ 8 ][ k ];
+                a[ 3 ][ k ] = b11 * r[ 1 ][ k ] + b12 * r[ 4 ][ k ] + b13 * r[ 7 ][ k ];
+                a[ 4 ][ k ] = b11 * r[ 2 ][ k ] + b12 * r[ 5 ][ k ] + b13 * r[ 8 ][ k ];
+                a[ 5 ][ k ] = b21 * r[ 2 ][ k ] + b22 * r[ 5 ][ k ] + b23 * r[ 8 ][ k ];
+            }
+
+            for ( int index = 0; index < 6; index++ ){
+                if ( columns[ index ] < 0 ){
+                    continue;
+                }
+                const T scale = index < 3 ? T( 1 ) : shear_inverse;
+                T *column = abaqus_block + columns[ index ] * nblock + first;
+                for ( int k = 0; k < rotationTileSize; k++ ){
+                    column[ k ] = scale * a[ index ][ k ];
+                }
             }
         }
 
-        return matrix_contraction;
+        for ( int k = tiled; k < nblock; k++ ){
+            T symmetric[ 6 ];
+            T rotation[ 9 ];
+            for ( int index = 0; index < 6; index++ ){
+                const T scale = index < 3 ? T( 1 ) : shear_scale;
+                symmetric[ index ] = columns[ index ] < 0 ? T( 0 ) : scale * abaqus_block[ columns[ index ] * nblock + k ];
+            }
+            for ( int index = 0; index < 9; index++ ){
+                rotation[ index ] = static_cast< T >( rotation_block[ index * nblock + k ] );
+            }
+            rotateSymmetric( symmetric, rotation );
+            for ( int index = 0; index < 6; index++ ){
+                if ( columns[ index ] >= 0 ){
+                    abaqus_block[ columns[ index ] * nblock + k ] = index < 3 ? symmetric[ index ] : shear_inverse * symmetric[ index ];
+                }
+            }
+        }
     }
 
-    template< typename T >
-    inline std::vector< T > expandFullNTENSTensor( const std::vector< T > &long_vector,
-                                                   const bool abaqus_standard = true ){
+    template< int NDI, int NSHR, AbaqusSolver SOLVER = AbaqusSolver::Standard, typename T, typename U >
+    inline void rotateNTENSVector( T *abaqus_vector, const U *rotation, const bool strain = false ){
         /*!
-         * Expand the full 3x3 tensor as a row-major vector from the expanded Abaqus stress-type NTENS vector of
-         * length 6. Handle the stress-type vector element order differences between Abaqus/Standard and
-         * Abaqus/Explicit.
-         *
-         * ``tardigradeAbaqusTools::expandAbaqusNTENSVector`` returns
-         *
-         * Abaqus/Standard (UMAT)
+         * Rotate a contracted Abaqus stress-type or strain-type vector in place, ``A' = R A R^T``, with compile time NDI,
+         * NSHR, and solver type. The equivalent of the Abaqus ``ROTSIG`` utility without forming the full 3x3 tensor.
+         * The by-definition-zero components are zero in the rotation, so the in-plane ``DROT`` of plane strain,
+         * axisymmetric, and plane stress elements rotates the in-plane components only.
          *
-         *     long_vector[]            0            1            2          3          4          5
-         *                   { \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{13}, \tau_{23}  }
-         *
-         * Abaqus/Explicit (VUMAT)
-         *
-         *     long_vector[]            0            1            2          3          4          5
-         *                   { \sigma_{11}, \sigma_{22}, \sigma_{33}, \tau_{12}, \tau_{23}, \tau_{13}  }
-         *
-         * \param &long_vector: a previously expanded Abaqus stress-type vector of length 6.
-         * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
-         *                         Default: True.
-         * \returns full_tensor: c++ type row major vector of length 9.
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param SOLVER: The Abaqus solver type. Default: Abaqus/Standard.
+         * \param *abaqus_vector: The contracted vector, e.g. the ``STRESS`` or ``STRAN`` pointer. Length NDI + NSHR.
+         * \param *rotation: The column major 3x3 rotation increment, e.g. the UMAT ``DROT`` pointer. R_ij is
+         *     ``rotation[ i + 3 * j ]``.
+         * \param strain: True for strain-type vectors with engineering shear strains, e.g. ``STRAN``; False for
+         *     stress-type vectors. Default: False.
          */
 
-        //Initialize internal vectors
-        std::vector< unsigned int > tensorOrder( 9 );
-
-        //Set the tensor packing order by Abaqus solver
-        if ( abaqus_standard ){
-            tensorOrder = { 0, 3, 4,
-                            3, 1, 5,
-                            4, 5, 2 };
-        }
-        else{
-            tensorOrder = { 0, 3, 5,
-                            3, 1, 4,
-                            5, 4, 2 };
-        }
-
-        //Pack the row-major full tensor
-        std::vector< T > full_tensor = { long_vector[tensorOrder[0]], long_vector[tensorOrder[1]], long_vector[tensorOrder[2]],
-                                         long_vector[tensorOrder[3]], long_vector[tensorOrder[4]], long_vector[tensorOrder[5]],
-                                         long_vector[tensorOrder[6]], long_vector[tensorOrder[7]], long_vector[tensorOrder[8]] };
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( rotateNTENSVector, 2 * ( NDI + NSHR ) * sizeof( T ) + 9 * sizeof( U ) );
 
-        return full_tensor;
+        checkNTENSTemplate< NDI, NSHR >( );
 
+        constexpr std::array< int, 6 > columns = symmetricRotationColumns( NDI, NSHR, SOLVER == AbaqusSolver::Standard );
+        rotateNTENSComponents( abaqus_vector, rotation, columns, strain );
     }
 
-    template< typename T >
-    inline std::vector< T > expandFullNTENSTensor( const std::vector< T > &abaqus_vector,
-                                                   const int &NDI, const int &NSHR,
-                                                   const bool abaqus_standard = true ){
+    template< typename T, typename U >
+    inline void rotateNTENSVector( T *abaqus_vector, const U *rotation, const int &NDI, const int &NSHR,
+                                   const bool strain = false, const bool abaqus_standard = true ){
         /*!
-         * Expand the full 3x3 tensor as a row-major vector from the contracted Abaqus stress-type vector of length
-         * NDI + NSHR. Handle the stress-type vector element order differences between Abaqus/Standard and
-         * Abaqus/Explicit.
+         * Rotate a contracted Abaqus stress-type or strain-type vector in place, ``A' = R A R^T``. The equivalent of the
+         * Abaqus ``ROTSIG`` utility without forming the full 3x3 tensor or allocating.
          *
-         * \param &abaqus_vector: an abaqus stress-type vector with no by-definition-zero components. Length NDI + NSHR.
+         * \param *abaqus_vector: The contracted vector, e.g. the ``STRESS`` or ``STRAN`` pointer. Length NDI + NSHR.
+         * \param *rotation: The column major 3x3 rotation increment, e.g. the UMAT ``DROT`` pointer. R_ij is
+         *     ``rotation[ i + 3 * j ]``.
          * \param &NDI: The number of direct components.
          * \param &NSHR: The number of shear components.
+         * \param strain: True for strain-type vectors with engineering shear strains, e.g. ``STRAN``; False for
+         *     stress-type vectors. Default: False.
          * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
          *                         Default: True.
-         * \returns full_tensor: c++ type row-major vector of length 9.
          */
 
-        //Expand the stress-type vector
-        std::vector< T > long_vector = tardigradeAbaqusTools::expandAbaqusNTENSVector( abaqus_vector, NDI, NSHR );
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( rotateNTENSVector, 2 * ( NDI + NSHR ) * sizeof( T ) + 9 * sizeof( U ) );
 
-        //Expand the full tensor
-        std::vector< T > full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( long_vector, abaqus_standard );
+        checkNTENS( NDI, NSHR );
 
-        return full_tensor;
+        if ( ( NDI == 3 && NSHR == 3 ) || ( NDI == 3 && NSHR == 1 ) || ( NDI == 2 && NSHR == 1 ) ){
+            dispatchNTENS( NDI, NSHR, [ & ]( auto ndi, auto nshr ){
+                dispatchSolver( abaqus_standard, [ & ]( auto solver ){
+                    rotateNTENSVector< decltype( ndi )::value, decltype( nshr )::value, decltype( solver )::value >(
+                        abaqus_vector, rotation, strain );
+                } );
+            } );
+            return;
+        }
 
+        rotateNTENSComponents( abaqus_vector, rotation, symmetricRotationColumns( NDI, NSHR, abaqus_standard ), strain );
     }
 
-    template< typename T >
-    inline std::vector< T > contractFullNTENSTensor( const std::vector< T > &full_tensor,
-                                                     const bool abaqus_standard = true ){
+    template< typename T, typename U >
+    inline void rotateNTENSVectorBatch( T *abaqus_vectors, const U *rotations, const int &npoints, const int &NDI,
+                                        const int &NSHR, const bool strain = false, const bool abaqus_standard = true ){
         /*!
-         * Contract a full 3x3 tensor stored as a row-major vector into the full Abaqus stress-type vector of length 6.
-         * Handle the stress-type vector element order differences between Abaqus/Standard and Abaqus/Explicit.
-         *
-         * The full tensor is stored as a row-major vector
-         *
-         *     full_tensor[]            0            1            2
-         *                   { \sigma_{11}, \sigma_{12}, \sigma_{13},
-         *
-         *     full_tensor[]            3            4            5
-         *                     \sigma_{12}, \sigma_{22}, \sigma_{23},
+         * Rotate the contracted vectors of several points in place, e.g. the ``STRESS(NTENS, NPT)`` array of a UEL,
+         * each by its own rotation. The component map is computed once for all points.
          *
-         *     full_tensor[]            6            7            8
-         *                     \sigma_{13}, \sigma_{23}, \sigma_{33} }
+         *     abaqus_vectors[ NTENS * point + component ]
+         *     rotations[ 9 * point + i + 3 * j ] = R_ij of the point
          *
-         * \param full_tensor: c++ type row-major vector of length 9.
+         * \param *abaqus_vectors: The pointer to the start of the NTENS x npoints column major vectors
+         * \param *rotations: The pointer to the start of the 3 x 3 x npoints column major rotations
+         * \param &npoints: The number of points
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param strain: True for strain-type vectors with engineering shear strains; False for stress-type vectors.
+         *     Default: False.
          * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
          *                         Default: True.
-         * \returns &full_abaqus_vector: an expanded abaqus stress-type vector. Length 6.
          */
 
-        //Initialize internal vectors
-        std::vector< unsigned int > tensorOrder( 6 );
-        std::vector< T > full_abaqus_vector( 6 );
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( rotateNTENSVector,
+                                            npoints * ( 2 * ( NDI + NSHR ) * sizeof( T ) + 9 * sizeof( U ) ) );
 
-        //Set the tensor unpacking order by Abaqus solver
-        if ( abaqus_standard ){
-            tensorOrder = { 0, 4, 8, 1, 2, 5 };
+        checkNTENS( NDI, NSHR );
+
+        const int NTENS = NDI + NSHR;
+        if ( ( NDI == 3 && NSHR == 3 ) || ( NDI == 3 && NSHR == 1 ) || ( NDI == 2 && NSHR == 1 ) ){
+            dispatchNTENS( NDI, NSHR, [ & ]( auto ndi, auto nshr ){
+                dispatchSolver( abaqus_standard, [ & ]( auto solver ){
+                    constexpr std::array< int, 6 > columns = symmetricRotationColumns( decltype( ndi )::value, decltype( nshr )::value,
+                                                                                       decltype( solver )::value == AbaqusSolver::Standard );
+                    for ( int point = 0; point < npoints; point++ ){
+                        rotateNTENSComponents( abaqus_vectors + NTENS * point, rotations + 9 * point, columns, strain );
+                    }
+                } );
+            } );
+            return;
         }
-        else{
-            tensorOrder = { 0, 4, 8, 1, 5, 2 };
+
+        const std::array< int, 6 > columns = symmetricRotationColumns( NDI, NSHR, abaqus_standard );
+        for ( int point = 0; point < npoints; point++ ){
+            rotateNTENSComponents( abaqus_vectors + NTENS * point, rotations + 9 * point, columns, strain );
         }
+    }
 
-        //Unpack the row-major full tensor
-        full_abaqus_vector = { full_tensor[tensorOrder[0]], full_tensor[tensorOrder[1]], full_tensor[tensorOrder[2]],
-                               full_tensor[tensorOrder[3]], full_tensor[tensorOrder[4]], full_tensor[tensorOrder[5]] };
+    template< int NDI, int NSHR, AbaqusSolver SOLVER, typename T, typename U >
+    inline void rotateNTENSBlock( T *abaqus_block, const U *rotation_block, const int &nblock, const bool strain = false ){
+        /*!
+         * Rotate a block of contracted vectors in place with compile time NDI, NSHR, and solver type. See the runtime
+         * overload for the block layouts.
+         *
+         * \param NDI: The number of direct components, e.g. the VUMAT ``ndir``.
+         * \param NSHR: The number of shear components, e.g. the VUMAT ``nshr``.
+         * \param SOLVER: The Abaqus solver type, e.g. Abaqus/Explicit for the VUMAT.
+         * \param *abaqus_block: The pointer to the start of the nblock x (NDI + NSHR) column major Abaqus block
+         * \param *rotation_block: The pointer to the start of the nblock x 9 column major rotation block
+         * \param &nblock: The number of material points in the block
+         * \param strain: True for strain-type vectors with engineering shear strains; False for stress-type vectors.
+         *     Tensorial shear strains, e.g. the VUMAT ``strainInc``, use ``strain = false``. Default: False.
+         */
 
-        return full_abaqus_vector;
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( rotateNTENSBlock,
+                                            nblock * ( 2 * ( NDI + NSHR ) * sizeof( T ) + 9 * sizeof( U ) ) );
 
+        checkNTENSTemplate< NDI, NSHR >( );
+
+        constexpr std::array< int, 6 > columns = symmetricRotationColumns( NDI, NSHR, SOLVER == AbaqusSolver::Standard );
+        rotateNTENSTiles( abaqus_block, rotation_block, nblock, columns, strain );
     }
 
-    template< typename T >
-    inline std::vector< T > contractFullNTENSTensor( const std::vector< T > &full_tensor,
-                                                     const int &NDI, const int &NSHR,
-                                                     const bool abaqus_standard = true ){
+    template< typename T, typename U >
+    inline void rotateNTENSBlock( T *abaqus_block, const U *rotation_block, const int &nblock, const int &NDI,
+                                  const int &NSHR, const bool strain, const bool abaqus_standard ){
         /*!
-         * Contract a full 3x3 tensor stored as a row-major vector into an Abaqus stress-type vector of length NDI +
-         * NSHR. Handle the stress-type vector element order differences between Abaqus/Standard and Abaqus/Explicit.
-         *
-         * The full tensor is stored as a row-major vector
+         * Rotate a block of contracted vectors in place, e.g. the VUMAT ``stressNew`` array, each point by its own
+         * rotation. Both blocks are column major (Fortran) arrays with one row per material point
          *
-         *     full_tensor[]            0            1            2
-         *                   { \sigma_{11}, \sigma_{12}, \sigma_{13},
-         *
-         *     full_tensor[]            3            4            5
-         *                     \sigma_{12}, \sigma_{22}, \sigma_{23},
+         *     abaqus_block[ component * nblock + k ], component in [0, NDI + NSHR)
+         *     rotation_block[ ( i + 3 * j ) * nblock + k ] = R_ij of point k
          *
-         *     full_tensor[]            6            7            8
-         *                     \sigma_{13}, \sigma_{23}, \sigma_{33} }
+         * so every component is contiguous across the block. Element types supported by ``dispatchNTENS`` use the
+         * compile time kernels. The Abaqus solver type is required, see ``expandFullNTENSTensorBlock``.
          *
-         * \param full_tensor: c++ type row-major vector of length 9.
+         * \param *abaqus_block: The pointer to the start of the nblock x (NDI + NSHR) column major Abaqus block
+         * \param *rotation_block: The pointer to the start of the nblock x 9 column major rotation block
+         * \param &nblock: The number of material points in the block
+         * \param &NDI: The number of direct components, e.g. the VUMAT ``ndir``.
+         * \param &NSHR: The number of shear components, e.g. the VUMAT ``nshr``.
+         * \param strain: True for strain-type vectors with engineering shear strains; False for stress-type vectors.
+         *     The VUMAT ``strainInc`` stores tensorial shear strains and is rotated with ``strain = false``.
          * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for Abaqus/Explicit.
-         *                         Default: True.
-         * \returns &abaqus_vector: a contracted abaqus stress-type vector. Length NDI + NSHR.
          */
 
-        //Contract to full length (6) abaqus stress-type vector
-        std::vector< T > full_abaqus_vector = contractFullNTENSTensor( full_tensor, abaqus_standard );
+        TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( rotateNTENSBlock,
+                                            nblock * ( 2 * ( NDI + NSHR ) * sizeof( T ) + 9 * sizeof( U ) ) );
 
-        //Contract the full length (6) vector to an abaqus stress-type vector of length NDI + NSHR
-        std::vector< T > abaqus_vector = contractAbaqusNTENSVector( full_abaqus_vector, NDI, NSHR );
+        checkNTENS( NDI, NSHR );
 
-        return abaqus_vector;
+        if ( ( NDI == 3 && NSHR == 3 ) || ( NDI == 3 && NSHR == 1 ) || ( NDI == 2 && NSHR == 1 ) ){
+            dispatchNTENS( NDI, NSHR, [ & ]( auto ndi, auto nshr ){
+                dispatchSolver( abaqus_standard, [ & ]( auto solver ){
+                    rotateNTENSBlock< decltype( ndi )::value, decltype( nshr )::value, decltype( solver )::value >(
+                        abaqus_block, rotation_block, nblock, strain );
+                } );
+            } );
+            return;
+        }
 
+        rotateNTENSTiles( abaqus_block, rotation_block, nblock, symmetricRotationColumns( NDI, NSHR, abaqus_standard ), strain );
     }
 
-    template< typename T >
-    inline std::vector< std::vector< T > > contractFullNTENSMatrix( const std::vector< std::vector< T > > &full_matrix){
+    template< int NDI, int NSHR, class Vector >
+    inline ScalarType< Vector > NTENSTrace( const Vector &abaqus_vector ){
         /*!
-         * Re-pack a full 9x9 matrix into the expected order for an expanded (6x6) Abaqus NTENS matrix. ONLY APPLIES TO
-         * ABAQUS/STANDARD Voigt matrices, e.g. Jaumann stiffness matrix.
+         * The trace of a tensor in the contracted Abaqus packing. The direct components lead both the Abaqus/Standard
+         * and Abaqus/Explicit packings.
          *
-         * Full 9x9 Matrix
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param &abaqus_vector: The contracted vector, e.g. the ``STRESS`` pointer. Length NDI + NSHR.
+         * \returns The trace
+         */
+
+        checkNTENSTemplate< NDI, NSHR >( );
+
+        ScalarType< Vector > trace = 0;
+        for ( int component = 0; component < NDI; component++ ){
+            trace += abaqus_vector[ component ];
+        }
+        return trace;
+    }
+
+    template< int NDI, int NSHR, class Vector >
+    inline std::array< ScalarType< Vector >, NDI + NSHR > NTENSDeviatoric( const Vector &abaqus_vector ){
+        /*!
+         * The deviatoric part of a stress-type tensor in the contracted Abaqus packing. For NDI < 3 the deviatoric parts
+         * of the by-definition-zero direct components, ``-trace / 3``, are not stored.
          *
-         * \f$ \left ( D_{1111}, D_{1112}, D_{1113}, D_{1121}, D_{1122}, D_{1123}, D_{1131}, D_{1132}, D_{1133} \right ) \f$
-         * \f$ \left ( D_{1211}, D_{1212}, D_{1213}, D_{1221}, D_{1222}, D_{1223}, D_{1231}, D_{1232}, D_{1233} \right ) \f$
-         * \f$ \left ( D_{1311}, D_{1312}, D_{1313}, D_{1321}, D_{1322}, D_{1323}, D_{1331}, D_{1332}, D_{1333} \right ) \f$
-         * \f$ \left ( D_{2111}, D_{2112}, D_{2113}, D_{2121}, D_{2122}, D_{2123}, D_{2131}, D_{2132}, D_{2133} \right ) \f$
-         * \f$ \left ( D_{2211}, D_{2212}, D_{2213}, D_{2221}, D_{2222}, D_{2223}, D_{2231}, D_{2232}, D_{2233} \right ) \f$
-         * \f$ \left ( D_{2311}, D_{2312}, D_{2313}, D_{2321}, D_{2322}, D_{2323}, D_{2331}, D_{2332}, D_{2333} \right ) \f$
-         * \f$ \left ( D_{3111}, D_{3112}, D_{3113}, D_{3121}, D_{3122}, D_{3123}, D_{3131}, D_{3132}, D_{3133} \right ) \f$
-         * \f$ \left ( D_{3211}, D_{3212}, D_{3213}, D_{3221}, D_{3222}, D_{3223}, D_{3231}, D_{3232}, D_{3233} \right ) \f$
-         * \f$ \left ( D_{3311}, D_{3312}, D_{3313}, D_{3321}, D_{3322}, D_{3323}, D_{3331}, D_{3332}, D_{3333} \right ) \f$
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param &abaqus_vector: The contracted stress-type vector, e.g. the ``STRESS`` pointer. Length NDI + NSHR.
+         * \returns The contracted deviatoric vector
+         */
+
+        const ScalarType< Vector > pressure = NTENSTrace< NDI, NSHR >( abaqus_vector ) / 3;
+
+        std::array< ScalarType< Vector >, NDI + NSHR > deviatoric;
+        for ( int component = 0; component < NDI + NSHR; component++ ){
+            deviatoric[ component ] = component < NDI ? abaqus_vector[ component ] - pressure : abaqus_vector[ component ];
+        }
+        return deviatoric;
+    }
+
+    template< int NDI, int NSHR, class Vector, class OtherVector >
+    inline ScalarType< Vector > NTENSDoubleContraction( const Vector &a, const OtherVector &b ){
+        /*!
+         * The double contraction ``A : B`` of two stress-type tensors in the contracted Abaqus packing. The shear
+         * components are counted twice for the symmetric off-diagonal pairs.
          *
-         * Abaqus/Standard 6x6 Matrix
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param &a: The first contracted stress-type vector. Length NDI + NSHR.
+         * \param &b: The second contracted stress-type vector. Length NDI + NSHR.
+         * \returns The double contraction
+         */
+
+        checkNTENSTemplate< NDI, NSHR >( );
+
+        ScalarType< Vector > direct = 0;
+        ScalarType< Vector > shear = 0;
+        for ( int component = 0; component < NDI; component++ ){
+            direct += a[ component ] * b[ component ];
+        }
+        for ( int component = NDI; component < NDI + NSHR; component++ ){
+            shear += a[ component ] * b[ component ];
+        }
+        return direct + 2 * shear;
+    }
+
+    template< int NDI, int NSHR, class Vector, class StrainVector >
+    inline ScalarType< Vector > NTENSWork( const Vector &stress, const StrainVector &strain ){
+        /*!
+         * The work density ``sigma : epsilon`` of a stress-type vector and a strain-type vector with engineering shear
+         * strains, e.g. ``STRESS`` and ``DSTRAN`` for the work increment. The engineering shear strains already carry
+         * the factor of two of the off-diagonal pairs.
          *
-         * \f$ \left ( D_{1111}, D_{1122}, D_{1133}, D_{1112}, D_{1113}, D_{1123} \right ) \f$
-         * \f$ \left ( D_{2211}, D_{2222}, D_{2233}, D_{2212}, D_{2213}, D_{2223} \right ) \f$
-         * \f$ \left ( D_{3311}, D_{3322}, D_{3333}, D_{3312}, D_{3313}, D_{3323} \right ) \f$
-         * \f$ \left ( D_{1211}, D_{1222}, D_{1233}, D_{1212}, D_{1213}, D_{1223} \right ) \f$
-         * \f$ \left ( D_{1311}, D_{1322}, D_{1333}, D_{1312}, D_{1313}, D_{1323} \right ) \f$
-         * \f$ \left ( D_{2311}, D_{2322}, D_{2333}, D_{2312}, D_{2313}, D_{2323} \right ) \f$
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param &stress: The contracted stress-type vector. Length NDI + NSHR.
+         * \param &strain: The contracted strain-type vector with engineering shear strains. Length NDI + NSHR.
+         * \returns The work density
+         */
+
+        checkNTENSTemplate< NDI, NSHR >( );
+
+        ScalarType< Vector > work = 0;
+        for ( int component = 0; component < NDI + NSHR; component++ ){
+            work += stress[ component ] * strain[ component ];
+        }
+        return work;
+    }
+
+    template< int NDI, int NSHR, class Vector >
+    inline ScalarType< Vector > NTENSNorm( const Vector &abaqus_vector, const bool strain = false ){
+        /*!
+         * The Frobenius norm ``sqrt( A : A )`` of a tensor in the contracted Abaqus packing
          *
-         * \param full_matrix: The c++ type matrix (vector of vectors) 9x9.
-         * \returns full_abaqus_matrix: Expanded 6x6 Voigt matrix with Abaqus/Standard element ordering.
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param &abaqus_vector: The contracted vector. Length NDI + NSHR.
+         * \param strain: True for strain-type vectors with engineering shear strains; False for stress-type vectors.
+         *     Default: False.
+         * \returns The norm
          */
 
-        //Initialize internal vectors
-        std::vector< unsigned int > tensorOrder( 6 );
-        std::vector< std::vector< T > > full_abaqus_matrix( 6, std::vector< T >( 6 ) );
+        checkNTENSTemplate< NDI, NSHR >( );
 
-        // abaqus/standard packing order
-        tensorOrder = { 0, 4, 8, 1, 2, 5 };
+        ScalarType< Vector > direct = 0;
+        ScalarType< Vector > shear = 0;
+        for ( int component = 0; component < NDI; component++ ){
+            direct += abaqus_vector[ component ] * abaqus_vector[ component ];
+        }
+        for ( int component = NDI; component < NDI + NSHR; component++ ){
+            shear += abaqus_vector[ component ] * abaqus_vector[ component ];
+        }
+        return std::sqrt( direct + ( strain ? ScalarType< Vector >( 0.5 ) : ScalarType< Vector >( 2 ) ) * shear );
+    }
 
-        //Repack the full matrix for Abaqus
-        for ( unsigned int i = 0; i < tensorOrder.size( ); i++ ){
-            for ( unsigned int j = 0; j < tensorOrder.size( ); j++ ){
-                full_abaqus_matrix[ i ][ j ] = full_matrix[ tensorOrder[ i ] ][ tensorOrder[ j ] ];
-            }
+    template< int NDI, int NSHR, class Vector >
+    inline ScalarType< Vector > NTENSVonMises( const Vector &stress ){
+        /*!
+         * The von Mises equivalent stress ``sqrt( 3 / 2 s : s )`` of a stress-type vector in the contracted Abaqus
+         * packing. The deviatoric parts of the by-definition-zero direct components of plane stress elements are
+         * included.
+         *
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param &stress: The contracted stress-type vector, e.g. the ``STRESS`` pointer. Length NDI + NSHR.
+         * \returns The von Mises equivalent stress
+         */
+
+        using T = ScalarType< Vector >;
+
+        const T pressure = NTENSTrace< NDI, NSHR >( stress ) / 3;
+
+        T direct = ( 3 - NDI ) * pressure * pressure;
+        T shear = 0;
+        for ( int component = 0; component < NDI; component++ ){
+            direct += ( stress[ component ] - pressure ) * ( stress[ component ] - pressure );
         }
+        for ( int component = NDI; component < NDI + NSHR; component++ ){
+            shear += stress[ component ] * stress[ component ];
+        }
+        return std::sqrt( T( 1.5 ) * ( direct + 2 * shear ) );
+    }
 
-        return full_abaqus_matrix;
+    template< int NDI, int NSHR, AbaqusSolver SOLVER = AbaqusSolver::Standard, class Vector >
+    inline std::array< ScalarType< Vector >, 3 > NTENSInvariants( const Vector &abaqus_vector, const bool strain = false ){
+        /*!
+         * The principal invariants ``I1 = tr( A )``, ``I2 = ( tr( A )^2 - A : A ) / 2``, and ``I3 = det( A )`` of a
+         * tensor in the contracted Abaqus packing. The determinant depends on which shear component is which, so the
+         * solver type selects the packing order.
+         *
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param SOLVER: The Abaqus solver type. Default: Abaqus/Standard.
+         * \param &abaqus_vector: The contracted vector. Length NDI + NSHR.
+         * \param strain: True for strain-type vectors with engineering shear strains; False for stress-type vectors.
+         *     Default: False.
+         * \returns The invariants I1, I2, and I3
+         */
+
+        using T = ScalarType< Vector >;
+
+        checkNTENSTemplate< NDI, NSHR >( );
 
+        constexpr std::array< int, 6 > columns = symmetricRotationColumns( NDI, NSHR, SOLVER == AbaqusSolver::Standard );
+
+        T a[ 6 ];
+        for ( int index = 0; index < 6; index++ ){
+            const T value = columns[ index ] < 0 ? T( 0 ) : abaqus_vector[ columns[ index ] ];
+            a[ index ] = ( strain && index >= 3 ) ? T( 0.5 ) * value : value;
+        }
+
+        // Components in the order 11, 22, 33, 12, 13, 23
+        return { a[ 0 ] + a[ 1 ] + a[ 2 ],
+                 a[ 0 ] * a[ 1 ] + a[ 1 ] * a[ 2 ] + a[ 0 ] * a[ 2 ] - a[ 3 ] * a[ 3 ] - a[ 4 ] * a[ 4 ] - a[ 5 ] * a[ 5 ],
+                 a[ 0 ] * ( a[ 1 ] * a[ 2 ] - a[ 5 ] * a[ 5 ] ) - a[ 3 ] * ( a[ 3 ] * a[ 2 ] - a[ 5 ] * a[ 4 ] )
+               + a[ 4 ] * ( a[ 3 ] * a[ 5 ] - a[ 1 ] * a[ 4 ] ) };
     }
 
-    template< typename T >
-    inline std::vector< std::vector < T > > contractFullNTENSMatrix( const std::vector< std::vector< T > > &full_matrix,
-                                                                     const int &NDI, const int &NSHR ){
+    template< int NDI, int NSHR, class Matrix, class Vector >
+    inline std::array< ScalarType< Vector >, NDI + NSHR > NTENSTangentProduct( const Matrix &DDSDDE, const Vector &strain ){
         /*!
-         * Re-pack a full 9x9 matrix into the expected order for the contracted (NTENSxNTENS) Abaqus NTENS matrix. ONLY
-         * APPLIES TO ABAQUS/STANDARD Voigt matrices, e.g. Jaumann stiffness matrix.
+         * The product of a column major (Fortran) NTENSxNTENS tangent and a strain-type vector, e.g. the stress
+         * increment ``DDSDDE . DSTRAN``. The Abaqus tangents act on engineering shear strains, so no shear weighting is
+         * needed.
          *
-         * Full 9x9 Matrix
+         * \param NDI: The number of direct components.
+         * \param NSHR: The number of shear components.
+         * \param &DDSDDE: The column major tangent, e.g. the ``DDSDDE`` pointer. Length ( NDI + NSHR ) * ( NDI + NSHR ).
+         * \param &strain: The contracted strain-type vector with engineering shear strains, e.g. the ``DSTRAN``
+         *     pointer. Length NDI + NSHR.
+         * \returns The contracted stress-type vector
+         */
+
+        checkNTENSTemplate< NDI, NSHR >( );
+
+        constexpr int NTENS = NDI + NSHR;
+
+        std::array< ScalarType< Vector >, NTENS > product{ };
+        for ( int col = 0; col < NTENS; col++ ){
+            for ( int row = 0; row < NTENS; row++ ){
+                product[ row ] += DDSDDE[ col * NTENS + row ] * strain[ col ];
+            }
+        }
+        return product;
+    }
+
+    //! Working set in bytes of one ``BatchConverter`` chunk. Half of a typical 32 KiB L1 data cache.
+    constexpr std::size_t batchChunkBytes = 16384;
+
+    template< typename T = double >
+    class BatchConverter{
+        /*!
+         * Convert every integration point of an element in one call, e.g. in a UEL or for the 27 points of a C3D20
+         * element, instead of one UMAT style conversion per point. NDI, NSHR, and the solver type are validated once at
+         * construction and each call is dispatched once to the compile time ``NDI``/``NSHR``/``AbaqusSolver`` kernels,
+         * whose index maps are immediate operands shared by every point. Element types not supported by
+         * ``dispatchNTENS`` run the same loops over the runtime NTENS with index maps computed at construction.
          *
-         * \f$ \left ( D_{1111}, D_{1112}, D_{1113}, D_{1121}, D_{1122}, D_{1123}, D_{1131}, D_{1132}, D_{1133} \right ) \f$
-         * \f$ \left ( D_{1211}, D_{1212}, D_{1213}, D_{1221}, D_{1222}, D_{1223}, D_{1231}, D_{1232}, D_{1233} \right ) \f$
-         * \f$ \left ( D_{1311}, D_{1312}, D_{1313}, D_{1321}, D_{1322}, D_{1323}, D_{1331}, D_{1332}, D_{1333} \right ) \f$
-         * \f$ \left ( D_{2111}, D_{2112}, D_{2113}, D_{2121}, D_{2122}, D_{2123}, D_{2131}, D_{2132}, D_{2133} \right ) \f$
-         * \f$ \left ( D_{2211}, D_{2212}, D_{2213}, D_{2221}, D_{2222}, D_{2223}, D_{2231}, D_{2232}, D_{2233} \right ) \f$
-         * \f$ \left ( D_{2311}, D_{2312}, D_{2313}, D_{2321}, D_{2322}, D_{2323}, D_{2331}, D_{2332}, D_{2333} \right ) \f$
-         * \f$ \left ( D_{3111}, D_{3112}, D_{3113}, D_{3121}, D_{3122}, D_{3123}, D_{3131}, D_{3132}, D_{3133} \right ) \f$
-         * \f$ \left ( D_{3211}, D_{3212}, D_{3213}, D_{3221}, D_{3222}, D_{3223}, D_{3231}, D_{3232}, D_{3233} \right ) \f$
-         * \f$ \left ( D_{3311}, D_{3312}, D_{3313}, D_{3321}, D_{3322}, D_{3323}, D_{3331}, D_{3332}, D_{3333} \right ) \f$
+         * The contracted arrays are column major (Fortran) arrays with the components of each point contiguous
          *
-         * Abaqus/Standard 6x6 Matrix
+         *     abaqus_vectors[ NTENS * point + component ], e.g. a STRESS(NTENS, NPT) array
+         *     abaqus_tangents[ NTENS * NTENS * point + col * NTENS + row ], e.g. a DDSDDE(NTENS, NTENS, NPT) array
          *
-         * \f$ \left ( D_{1111}, D_{1122}, D_{1133}, D_{1112}, D_{1113}, D_{1123} \right ) \f$
-         * \f$ \left ( D_{2211}, D_{2222}, D_{2233}, D_{2212}, D_{2213}, D_{2223} \right ) \f$
-         * \f$ \left ( D_{3311}, D_{3322}, D_{3333}, D_{3312}, D_{3313}, D_{3323} \right ) \f$
-         * \f$ \left ( D_{1211}, D_{1222}, D_{1233}, D_{1212}, D_{1213}, D_{1223} \right ) \f$
-         * \f$ \left ( D_{1311}, D_{1322}, D_{1333}, D_{1312}, D_{1313}, D_{1323} \right ) \f$
-         * \f$ \left ( D_{2311}, D_{2322}, D_{2333}, D_{2312}, D_{2313}, D_{2323} \right ) \f$
+         * and the full arrays are row major npoints x 9 tensors and npoints x 81 tangents. The contracted arrays may
+         * use a different scalar type than the full arrays, e.g. single precision state storage.
          *
-         * Where the output matrix from this function omits the by-definition zero valued components determined by NDI
-         * and NSHR.
+         * ``update`` runs an expand, compute, contract pipeline over chunks of points sized to fit ``batchChunkBytes``
+         * so that the full tensors stay in L1 between the conversions. The chunk buffers are allocated once at
+         * construction, so a converter must not be shared between threads.
          *
-         * \param full_matrix: The c++ type matrix (vector of vectors) 9x9.
-         * \param &NDI: The number of direct components.
-         * \param &NSHR: The number of shear components.
-         * \returns &abaqus_matrix: A contracted Abaqus Voigt matrix with dimensions NTENSxNTENS where NTENS = NDI +
-         *                          NSHR.
+         * \param T: The scalar type of the full tensors and tangents
          */
 
-        //Initialize internal vectors
-        std::vector< std::vector< T > > full_abaqus_matrix( 6, std::vector< T >( 6 ) );
-        std::vector< std::vector< T > > abaqus_matrix( NDI + NSHR, std::vector< T >( NDI + NSHR ) );
+        public:
 
-        //Detruct to 6x6
-        full_abaqus_matrix = contractFullNTENSMatrix( full_matrix );
+            //! Number of points per chunk of the full tensor pipeline
+            static constexpr int tensorChunkPoints = static_cast< int >( batchChunkBytes / ( 9 * sizeof( T ) ) );
 
-        //Contract to NTENSxNTENS
-        abaqus_matrix = contractAbaqusNTENSMatrix( full_abaqus_matrix, NDI, NSHR );
+            //! Number of points per chunk of the full tensor and tangent pipeline
+            static constexpr int tangentChunkPoints = static_cast< int >( batchChunkBytes / ( 90 * sizeof( T ) ) );
 
-        return abaqus_matrix;
+            BatchConverter( const int &NDI, const int &NSHR, const bool abaqus_standard = true ) :
+                _NDI( NDI ), _NSHR( NSHR ), _NTENS( NDI + NSHR ), _abaqus_standard( abaqus_standard ),
+                _tensor_chunk( 9 * tensorChunkPoints ), _tangent_chunk( 81 * tangentChunkPoints ){
+                /*!
+                 * \param &NDI: The number of direct components.
+                 * \param &NSHR: The number of shear components.
+                 * \param abaqus_standard: boolean for Abaqus solver type. True for Abaqus/Standard; False for
+                 *     Abaqus/Explicit. Default: True.
+                 */
+                checkNTENS( NDI, NSHR );
+                _compile_time = ( NDI == 3 && NSHR == 3 ) || ( NDI == 3 && NSHR == 1 ) || ( NDI == 2 && NSHR == 1 );
+                _expand_index = fullTensorNTENSIndex( NDI, NSHR, abaqus_standard );
+                _contract_index = NTENSFullTensorIndex( NDI, NSHR, abaqus_standard );
+            }
 
-    }
+            int NDI( ) const{
+                /*!
+                 * \returns The number of direct components
+                 */
+                return _NDI;
+            }
+
+            int NSHR( ) const{
+                /*!
+                 * \returns The number of shear components
+                 */
+                return _NSHR;
+            }
+
+            int NTENS( ) const{
+                /*!
+                 * \returns The number of contracted components
+                 */
+                return _NTENS;
+            }
+
+            bool abaqusStandard( ) const{
+                /*!
+                 * \returns True for the Abaqus/Standard packing order; False for Abaqus/Explicit
+                 */
+                return _abaqus_standard;
+            }
+
+            template< typename U >
+            void expandTensors( T *full_tensors, const U *abaqus_vectors, const int &npoints ) const{
+                /*!
+                 * Expand the contracted stress-type vectors of every point into full 3x3 tensors. Three dimensional
+                 * elements use the SIMD batch kernels.
+                 *
+                 * \param *full_tensors: The pointer to the start of the npoints x 9 row major output
+                 * \param *abaqus_vectors: The pointer to the start of the NTENS x npoints column major input
+                 * \param &npoints: The number of points
+                 */
+                if ( _NTENS == 6 ){
+                    expandFullNTENSTensorBatch( full_tensors, abaqus_vectors, npoints, _abaqus_standard );
+                    return;
+                }
+
+                TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSTensorBatch,
+                                                    npoints * ( 9 * sizeof( T ) + _NTENS * sizeof( U ) ) );
+
+                dispatch( [ & ]( auto NTENS, const std::array< int, 9 > &index_map, const std::array< unsigned int, 6 > & ){
+                    for ( int point = 0; point < npoints; point++ ){
+                        const U *input = abaqus_vectors + NTENS * point;
+                        T *output = full_tensors + 9 * point;
+                        for ( unsigned int index = 0; index < 9; index++ ){
+                            output[ index ] = index_map[ index ] < 0 ? T( 0 ) : static_cast< T >( input[ index_map[ index ] ] );
+                        }
+                    }
+                } );
+            }
+
+            template< typename U >
+            void contractTensors( U *abaqus_vectors, const T *full_tensors, const int &npoints ) const{
+                /*!
+                 * Contract the full 3x3 tensors of every point into contracted stress-type vectors. Three dimensional
+                 * elements use the SIMD batch kernels.
+                 *
+                 * \param *abaqus_vectors: The pointer to the start of the NTENS x npoints column major output
+                 * \param *full_tensors: The pointer to the start of the npoints x 9 row major input
+                 * \param &npoints: The number of points
+                 */
+                if ( _NTENS == 6 ){
+                    contractFullNTENSTensorBatch( abaqus_vectors, full_tensors, npoints, _abaqus_standard );
+                    return;
+                }
+
+                TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSTensorBatch,
+                                                    npoints * ( 9 * sizeof( T ) + _NTENS * sizeof( U ) ) );
+
+                dispatch( [ & ]( auto NTENS, const std::array< int, 9 > &, const std::array< unsigned int, 6 > &index_map ){
+                    for ( int point = 0; point < npoints; point++ ){
+                        const T *input = full_tensors + 9 * point;
+                        U *output = abaqus_vectors + NTENS * point;
+                        for ( int index = 0; index < NTENS; index++ ){
+                            output[ index ] = static_cast< U >( input[ index_map[ index ] ] );
+                        }
+                    }
+                } );
+            }
+
+            template< typename U >
+            void expandTangents( T *full_tangents, const U *abaqus_tangents, const int &npoints ) const{
+                /*!
+                 * Expand the column major NTENS x NTENS tangents of every point into row major 9x9 tangents. The
+                 * by-definition-zero components are zero.
+                 *
+                 * \param *full_tangents: The pointer to the start of the npoints x 81 row major output
+                 * \param *abaqus_tangents: The pointer to the start of the NTENS x NTENS x npoints column major input
+                 * \param &npoints: The number of points
+                 */
+
+                TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( expandFullNTENSMatrix,
+                                                    npoints * ( 81 * sizeof( T ) + _NTENS * _NTENS * sizeof( U ) ) );
+
+                dispatch( [ & ]( auto NTENS, const std::array< int, 9 > &index_map, const std::array< unsigned int, 6 > & ){
+                    for ( int point = 0; point < npoints; point++ ){
+                        const U *input = abaqus_tangents + NTENS * NTENS * point;
+                        T *output = full_tangents + 81 * point;
+                        for ( unsigned int i = 0; i < 9; i++ ){
+                            for ( unsigned int j = 0; j < 9; j++ ){
+                                output[ 9 * i + j ] = ( ( index_map[ i ] < 0 ) || ( index_map[ j ] < 0 ) ) ?
+                                                      T( 0 ) : static_cast< T >( input[ index_map[ j ] * NTENS + index_map[ i ] ] );
+                            }
+                        }
+                    }
+                } );
+            }
+
+            template< typename U >
+            void contractTangents( U *abaqus_tangents, const T *full_tangents, const int &npoints ) const{
+                /*!
+                 * Contract the row major 9x9 tangents of every point into column major NTENS x NTENS tangents
+                 *
+                 * \param *abaqus_tangents: The pointer to the start of the NTENS x NTENS x npoints column major output
+                 * \param *full_tangents: The pointer to the start of the npoints x 81 row major input
+                 * \param &npoints: The number of points
+                 */
+
+                TARDIGRADE_ABAQUS_TOOLS_INSTRUMENT( contractFullNTENSMatrix,
+                                                    npoints * ( 81 * sizeof( T ) + _NTENS * _NTENS * sizeof( U ) ) );
+
+                dispatch( [ & ]( auto NTENS, const std::array< int, 9 > &, const std::array< unsigned int, 6 > &index_map ){
+                    for ( int point = 0; point < npoints; point++ ){
+                        const T *input = full_tangents + 81 * point;
+                        U *output = abaqus_tangents + NTENS * NTENS * point;
+                        for ( int col = 0; col < NTENS; col++ ){
+                            for ( int row = 0; row < NTENS; row++ ){
+                                output[ col * NTENS + row ] = static_cast< U >( input[ 9 * index_map[ row ] + index_map[ col ] ] );
+                            }
+                        }
+                    }
+                } );
+            }
+
+            template< typename U >
+            RowMajorView< T, dynamicExtent, 9 > expandTensors( const U *abaqus_vectors, const int &npoints,
+                                                               BumpArena &arena = threadArena( ) ) const{
+                /*!
+                 * Expand the contracted stress-type vectors of every point into full 3x3 tensors allocated from an
+                 * arena. The memory is reclaimed by ``arena.reset( )``, e.g. at the end of the UEL call.
+                 *
+                 * \param *abaqus_vectors: The pointer to the start of the NTENS x npoints column major input
+                 * \param &npoints: The number of points
+                 * \param &arena: The arena providing the output. Default: the calling thread's arena.
+                 * \returns A view of the npoints x 9 row major full tensors
+                 */
+                T *full_tensors = static_cast< T* >( arena.allocate( 9 * npoints * sizeof( T ), alignof( T ) ) );
+                expandTensors( full_tensors, abaqus_vectors, npoints );
+                return RowMajorView< T, dynamicExtent, 9 >( full_tensors, npoints, 9 );
+            }
+
+            template< typename U >
+            RowMajorView< T, dynamicExtent, 81 > expandTangents( const U *abaqus_tangents, const int &npoints,
+                                                                 BumpArena &arena = threadArena( ) ) const{
+                /*!
+                 * Expand the tangents of every point into row major 9x9 tangents allocated from an arena. The memory
+                 * is reclaimed by ``arena.reset( )``.
+                 *
+                 * \param *abaqus_tangents: The pointer to the start of the NTENS x NTENS x npoints column major input
+                 * \param &npoints: The number of points
+                 * \param &arena: The arena providing the output. Default: the calling thread's arena.
+                 * \returns A view of the npoints x 81 row major full tangents
+                 */
+                T *full_tangents = static_cast< T* >( arena.allocate( 81 * npoints * sizeof( T ), alignof( T ) ) );
+                expandTangents( full_tangents, abaqus_tangents, npoints );
+                return RowMajorView< T, dynamicExtent, 81 >( full_tangents, npoints, 81 );
+            }
+
+            template< typename U, class Function >
+            void update( U *abaqus_vectors, const int &npoints, Function &&function ){
+                /*!
+                 * Expand, update, and contract the stress-type vectors of every point in chunks of
+                 * ``tensorChunkPoints``. The function is called once per chunk as
+                 *
+                 *     function( RowMajorView< T, dynamicExtent, 9 > full_tensors, int first_point )
+                 *
+                 * and updates the full tensors of the points [first_point, first_point + full_tensors.height( ) ) in
+                 * place. The results are contracted back into ``abaqus_vectors``.
+                 *
+                 * \param *abaqus_vectors: The pointer to the start of the NTENS x npoints column major array
+                 * \param &npoints: The number of points
+                 * \param &&function: The update of each chunk
+                 */
+                for ( int first = 0; first < npoints; first += tensorChunkPoints ){
+                    const int count = std::min( tensorChunkPoints, npoints - first );
+                    expandTensors( _tensor_chunk.data( ), abaqus_vectors + _NTENS * first, count );
+                    function( RowMajorView< T, dynamicExtent, 9 >( _tensor_chunk.data( ), count, 9 ), first );
+                    contractTensors( abaqus_vectors + _NTENS * first, _tensor_chunk.data( ), count );
+                }
+            }
+
+            template< typename U, typename V, class Function >
+            void update( U *abaqus_vectors, V *abaqus_tangents, const int &npoints, Function &&function ){
+                /*!
+                 * Expand and update the stress-type vectors and compute the tangents of every point in chunks of
+                 * ``tangentChunkPoints``. The function is called once per chunk as
+                 *
+                 *     function( RowMajorView< T, dynamicExtent, 9 > full_tensors,
+                 *               RowMajorView< T, dynamicExtent, 81 > full_tangents, int first_point )
+                 *
+                 * The full tangents are zero on entry. The results are contracted back into ``abaqus_vectors`` and
+                 * ``abaqus_tangents``.
+                 *
+                 * \param *abaqus_vectors: The pointer to the start of the NTENS x npoints column major array
+                 * \param *abaqus_tangents: The pointer to the start of the NTENS x NTENS x npoints column major output
+                 * \param &npoints: The number of points
+                 * \param &&function: The update of each chunk
+                 */
+                for ( int first = 0; first < npoints; first += tangentChunkPoints ){
+                    const int count = std::min( tangentChunkPoints, npoints - first );
+                    expandTensors( _tensor_chunk.data( ), abaqus_vectors + _NTENS * first, count );
+                    std::fill( _tangent_chunk.begin( ), _tangent_chunk.begin( ) + 81 * count, T( 0 ) );
+                    function( RowMajorView< T, dynamicExtent, 9 >( _tensor_chunk.data( ), count, 9 ),
+                              RowMajorView< T, dynamicExtent, 81 >( _tangent_chunk.data( ), count, 81 ), first );
+                    contractTensors( abaqus_vectors + _NTENS * first, _tensor_chunk.data( ), count );
+                    contractTangents( abaqus_tangents + _NTENS * _NTENS * first, _tangent_chunk.data( ), count );
+                }
+            }
+
+        private:
+
+            template< class Function >
+            void dispatch( Function &&function ) const{
+                /*!
+                 * Call the kernel as ``function( NTENS, expand_map, contract_map )``. The element types supported by
+                 * ``dispatchNTENS`` pass NTENS as a ``std::integral_constant`` and the compile time index maps of
+                 * their NDI, NSHR, and solver type. Other element types pass the runtime NTENS and the index maps
+                 * computed at construction.
+                 *
+                 * \param &&function: The generic kernel
+                 */
+                if ( !_compile_time ){
+                    function( _NTENS, _expand_index, _contract_index );
+                    return;
+                }
+                dispatchNTENS( _NDI, _NSHR, [ & ]( auto ndi, auto nshr ){
+                    dispatchSolver( _abaqus_standard, [ & ]( auto solver ){
+                        constexpr int NDI = decltype( ndi )::value;
+                        constexpr int NSHR = decltype( nshr )::value;
+                        constexpr bool STANDARD = decltype( solver )::value == AbaqusSolver::Standard;
+                        function( std::integral_constant< int, NDI + NSHR >( ), fullTensorNTENSMap< NDI, NSHR, STANDARD >,
+                                  NTENSFullTensorMap< NDI, NSHR, STANDARD > );
+                    } );
+                } );
+            }
+
+            int _NDI;
+
+            int _NSHR;
+
+            int _NTENS;
+
+            bool _abaqus_standard;
+
+            //! True when NDI and NSHR have a compile time specialization
+            bool _compile_time;
+
+            //! Contracted vector index of each full tensor component or -1
+            std::array< int, 9 > _expand_index;
+
+            //! Full tensor index of each contracted vector component
+            std::array< unsigned int, 6 > _contract_index;
+
+            std::vector< T > _tensor_chunk;
+
+            std::vector< T > _tangent_chunk;
+
+    };
 
 }
 
@@ -0,0 +1,1297 @@
+/**
+  ******************************************************************************
+  * \file tardigrade_abaqus_tools_io.h
+  ******************************************************************************
+  * Binary input and output for the abaqus tools library. Records the UMAT and
+  * VUMAT arguments of an analysis and replays them without Abaqus, and writes
+  * and reads columnar snapshots of the model state.
+  ******************************************************************************
+  */
+
+#ifndef TARDIGRADE_ABAQUS_TOOLS_IO_H
+#define TARDIGRADE_ABAQUS_TOOLS_IO_H
+
+#include<cstdint>
+#include<cstring>
+#include<cerrno>
+#include<limits>
+#include<fcntl.h>
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<unistd.h>
+
+#include<tardigrade_abaqus_tools.h>
+
+namespace tardigradeAbaqusTools{
+
+    class MappedFile{
+        /*!
+         * Read-only memory mapping of a whole file. The pages are loaded by the kernel on first access and shared with
+         * the page cache, so large traces are read without copies. Move only.
+         */
+
+        public:
+
+            MappedFile( ) = default;
+
+            explicit MappedFile( const std::string &filename ){
+                /*!
+                 * \param &filename: The file to map
+                 */
+                const int descriptor = ::open( filename.c_str( ), O_RDONLY );
+                if ( descriptor < 0 ){
+                    throw std::runtime_error( "Could not open " + filename + ": " + strerror( errno ) );
+                }
+                struct stat status;
+                if ( ::fstat( descriptor, &status ) != 0 ){
+                    ::close( descriptor );
+                    throw std::runtime_error( "Could not stat " + filename + ": " + strerror( errno ) );
+                }
+                _size = static_cast< std::size_t >( status.st_size );
+                if ( _size > 0 ){
+                    void *address = ::mmap( nullptr, _size, PROT_READ, MAP_PRIVATE, descriptor, 0 );
+                    if ( address == MAP_FAILED ){
+                        ::close( descriptor );
+                        throw std::runtime_error( "Could not map " + filename + ": " + strerror( errno ) );
+                    }
+                    _data = static_cast< const char* >( address );
+                    ::madvise( address, _size, MADV_SEQUENTIAL );
+                }
+                ::close( descriptor );
+            }
+
+            MappedFile( MappedFile &&other ) noexcept : _data( other._data ), _size( other._size ){
+                other._data = nullptr;
+                other._size = 0;
+            }
+
+            MappedFile &operator=( MappedFile &&other ) noexcept{
+                if ( this != &other ){
+                    unmap( );
+                    _data = other._data;
+                    _size = other._size;
+                    other._data = nullptr;
+                    other._size = 0;
+                }
+                return *this;
+            }
+
+            MappedFile( const MappedFile & ) = delete;
+
+            MappedFile &operator=( const MappedFile & ) = delete;
+
+            ~MappedFile( ){
+                unmap( );
+            }
+
+            const char *data( ) const{
+                /*!
+                 * \returns The start of the mapping. Page aligned.
+                 */
+                return _data;
+            }
+
+            std::size_t size( ) const{
+                /*!
+                 * \returns The size of the file in bytes
+                 */
+                return _size;
+            }
+
+        private:
+
+            void unmap( ){
+                if ( _data != nullptr ){
+                    ::munmap( const_cast< char* >( _data ), _size );
+                }
+                _data = nullptr;
+                _size = 0;
+            }
+
+            const char *_data = nullptr;
+
+            std::size_t _size = 0;
+
+    };
+
+    //! Identifies a UMAT trace file
+    constexpr char umatTraceMagic[ 8 ] = { 'T', 'A', 'T', 'U', 'M', 'A', 'T', '\0' };
+
+    //! Version of the UMAT trace format
+    constexpr std::uint32_t umatTraceVersion = 1;
+
+    //! Identifies a VUMAT trace file
+    constexpr char vumatTraceMagic[ 8 ] = { 'T', 'A', 'T', 'V', 'U', 'M', 'A', 'T' };
+
+    //! Version of the VUMAT trace format
+    constexpr std::uint32_t vumatTraceVersion = 1;
+
+    struct UMATTraceFileHeader{
+        /*!
+         * The header at the start of a UMAT or VUMAT trace file
+         */
+
+        char magic[ 8 ];
+
+        //! The trace format version
+        std::uint32_t version;
+
+        //! The size of the recorded floating point values in bytes
+        std::uint32_t scalar_size;
+
+    };
+
+    struct UMATTraceRecordHeader{
+        /*!
+         * The header of each UMAT trace record. The header is followed by the trimmed ``CMNAME`` padded to a multiple of
+         * 8 bytes and the ``STRESS(NTENS)``, ``STATEV(NSTATV)``, ``DDSDDE(NTENS, NTENS)``, ``STRAN(NTENS)``, and
+         * ``DSTRAN(NTENS)`` arrays in Fortran order, so every array of a mapped trace is 8 byte aligned.
+         */
+
+        std::int32_t NDI;
+
+        std::int32_t NSHR;
+
+        std::int32_t NSTATV;
+
+        //! The number of characters of the trimmed ``CMNAME``
+        std::int32_t CMNAME_length;
+
+    };
+
+    struct VUMATTraceRecordHeader{
+        /*!
+         * The header of each VUMAT trace record. The header is followed by the trimmed ``cmname`` padded to a multiple
+         * of 8 bytes and the ``stressOld(nblock, ndir + nshr)``, ``stateOld(nblock, nstatev)``, and
+         * ``strainInc(nblock, ndir + nshr)`` blocks in Fortran order, so every block of a mapped trace is 8 byte aligned.
+         */
+
+        std::int32_t nblock;
+
+        std::int32_t ndir;
+
+        std::int32_t nshr;
+
+        std::int32_t nstatev;
+
+        //! The number of characters of the trimmed ``cmname``
+        std::int32_t cmname_length;
+
+        //! Pads the header to a multiple of 8 bytes
+        std::int32_t reserved;
+
+    };
+
+    static_assert( sizeof( UMATTraceFileHeader ) == 16, "The UMAT trace file header must be 16 bytes" );
+    static_assert( sizeof( UMATTraceRecordHeader ) == 16, "The UMAT trace record header must be 16 bytes" );
+    static_assert( sizeof( VUMATTraceRecordHeader ) == 24, "The VUMAT trace record header must be 24 bytes" );
+
+    constexpr std::size_t umatTracePadding( const std::size_t &bytes ){
+        /*!
+         * \param &bytes: A number of bytes
+         * \returns The number of bytes rounded up to a multiple of 8
+         */
+        return ( bytes + 7 ) & ~std::size_t( 7 );
+    }
+
+    constexpr std::size_t umatTraceRecordSize( const int &NTENS, const int &NSTATV, const int &CMNAME_length ){
+        /*!
+         * \param &NTENS: The number of contracted components
+         * \param &NSTATV: The number of state variables
+         * \param &CMNAME_length: The number of characters of the trimmed material name
+         * \returns The size of a UMAT trace record in bytes including its header
+         */
+        const std::size_t ntens = NTENS;
+        return sizeof( UMATTraceRecordHeader ) + umatTracePadding( CMNAME_length ) +
+               sizeof( double ) * ( 3 * ntens + ntens * ntens + std::size_t( NSTATV ) );
+    }
+
+    constexpr std::size_t vumatTraceRecordSize( const int &nblock, const int &ntens, const int &nstatev,
+                                                const int &cmname_length ){
+        /*!
+         * \param &nblock: The number of material points in the block
+         * \param &ntens: The number of contracted components
+         * \param &nstatev: The number of state variables
+         * \param &cmname_length: The number of characters of the trimmed material name
+         * \returns The size of a VUMAT trace record in bytes including its header
+         */
+        return sizeof( VUMATTraceRecordHeader ) + umatTracePadding( cmname_length ) +
+               sizeof( double ) * std::size_t( nblock ) * ( 2 * std::size_t( ntens ) + std::size_t( nstatev ) );
+    }
+
+    class TraceRecorder{
+        /*!
+         * The trace file shared by ``UMATRecorder`` and ``VUMATRecorder``. Calls from multiple threads are serialized,
+         * and each record is written with a single write so concurrent records do not interleave.
+         *
+         * A failed write, e.g. on a full disk, latches ``good( )`` to false, reports the failure once on ``std::cerr``,
+         * and stops recording rather than throwing through the calling UMAT or VUMAT.
+         */
+
+        public:
+
+            void flush( ){
+                /*!
+                 * Write the buffered records to the file
+                 */
+                std::lock_guard< std::mutex > lock( _mutex );
+                if ( !_failed ){
+                    _file.flush( );
+                    checkStream( );
+                }
+            }
+
+            bool good( ){
+                /*!
+                 * \returns False once a write to the trace file failed
+                 */
+                std::lock_guard< std::mutex > lock( _mutex );
+                return !_failed;
+            }
+
+            const std::string &filename( ) const{
+                /*!
+                 * \returns The trace file name
+                 */
+                return _filename;
+            }
+
+            std::size_t records( ){
+                /*!
+                 * \returns The number of recorded calls
+                 */
+                std::lock_guard< std::mutex > lock( _mutex );
+                return _records;
+            }
+
+        protected:
+
+            TraceRecorder( const std::string &filename, const char ( &magic )[ 8 ], const std::uint32_t &version,
+                           const std::string &kind ) :
+                _filename( filename ), _kind( kind ), _file( filename, std::ios::binary | std::ios::trunc ){
+                /*!
+                 * \param &filename: The trace file. Existing files are overwritten.
+                 * \param &magic: The identifier of the trace type
+                 * \param &version: The version of the trace format
+                 * \param &kind: The name of the recorded subroutine in messages, e.g. UMAT
+                 */
+                if ( !_file ){
+                    throw std::runtime_error( "Could not open the " + kind + " trace file " + filename );
+                }
+                UMATTraceFileHeader header{ };
+                std::copy( std::begin( magic ), std::end( magic ), header.magic );
+                header.version = version;
+                header.scalar_size = sizeof( double );
+                _file.write( reinterpret_cast< const char* >( &header ), sizeof( header ) );
+                checkStream( );
+            }
+
+            template< class Fill >
+            void write( const std::size_t &bytes, Fill &&fill ){
+                /*!
+                 * Append one record unless a previous write failed
+                 *
+                 * \param &bytes: The size of the record in bytes
+                 * \param &&fill: Called as ``fill( char *record )`` to fill the zero initialized record
+                 */
+                std::lock_guard< std::mutex > lock( _mutex );
+                if ( _failed ){
+                    return;
+                }
+                _buffer.assign( bytes, 0 );
+                fill( _buffer.data( ) );
+                _file.write( _buffer.data( ), _buffer.size( ) );
+                if ( checkStream( ) ){
+                    _records++;
+                }
+            }
+
+            static char *append( char *cursor, const void *source, const std::size_t &bytes ){
+                if ( bytes > 0 ){
+                    std::memcpy( cursor, source, bytes );
+                }
+                return cursor + bytes;
+            }
+
+        private:
+
+            bool checkStream( ){
+                /*!
+                 * Latch the failure flag when the stream failed. Must be called with the mutex held.
+                 *
+                 * \returns True if the stream is still good
+                 */
+                if ( !_file ){
+                    _failed = true;
+                    std::cerr << "Could not write the " << _kind << " trace file " << _filename << ". Recording stopped.\n";
+                }
+                return !_failed;
+            }
+
+            std::string _filename;
+
+            std::string _kind;
+
+            std::ofstream _file;
+
+            bool _failed = false;
+
+            std::mutex _mutex;
+
+            std::vector< char > _buffer;
+
+            std::size_t _records = 0;
+
+    };
+
+    class UMATRecorder : public TraceRecorder{
+        /*!
+         * Append the arguments of UMAT calls to a binary trace file. Replay the trace with ``UMATTrace`` or the
+         * ``replay_tardigrade_abaqus_tools`` executable. See ``TraceRecorder`` for the thread safety and failure
+         * handling.
+         *
+         * In a UMAT, record through ``recordUMAT``, which is enabled by the ``TARDIGRADE_ABAQUS_TOOLS_TRACE_FILE``
+         * environment variable.
+         */
+
+        public:
+
+            explicit UMATRecorder( const std::string &filename ) :
+                TraceRecorder( filename, umatTraceMagic, umatTraceVersion, "UMAT" ){
+                /*!
+                 * \param &filename: The trace file. Existing files are overwritten.
+                 */
+            }
+
+            void record( const double *STRESS, const double *STATEV, const double *DDSDDE, const double *STRAN,
+                         const double *DSTRAN, const int &NDI, const int &NSHR, const int &NSTATV,
+                         const char *CMNAME, const int &CMNAME_length ){
+                /*!
+                 * Append one UMAT call to the trace. Record the arguments at the start of the UMAT, before they are
+                 * updated.
+                 *
+                 * \param *STRESS: The UMAT ``STRESS`` array. Length NDI + NSHR.
+                 * \param *STATEV: The UMAT ``STATEV`` array. Length NSTATV.
+                 * \param *DDSDDE: The UMAT ``DDSDDE`` array. Length ( NDI + NSHR ) * ( NDI + NSHR ).
+                 * \param *STRAN: The UMAT ``STRAN`` array. Length NDI + NSHR.
+                 * \param *DSTRAN: The UMAT ``DSTRAN`` array. Length NDI + NSHR.
+                 * \param &NDI: The number of direct components.
+                 * \param &NSHR: The number of shear components.
+                 * \param &NSTATV: The number of state variables.
+                 * \param *CMNAME: The Fortran material name
+                 * \param &CMNAME_length: The length of the Fortran material name, e.g. 80
+                 */
+                checkNTENS( NDI, NSHR );
+                const int NTENS = NDI + NSHR;
+                const std::string_view name = FtoStringView( CMNAME_length, CMNAME );
+                const UMATTraceRecordHeader header{ NDI, NSHR, NSTATV, static_cast< std::int32_t >( name.size( ) ) };
+
+                write( umatTraceRecordSize( NTENS, NSTATV, header.CMNAME_length ), [ & ]( char *cursor ){
+                    cursor = append( cursor, &header, sizeof( header ) );
+                    append( cursor, name.data( ), name.size( ) );
+                    cursor += umatTracePadding( name.size( ) );
+                    cursor = append( cursor, STRESS, NTENS * sizeof( double ) );
+                    cursor = append( cursor, STATEV, NSTATV * sizeof( double ) );
+                    cursor = append( cursor, DDSDDE, NTENS * NTENS * sizeof( double ) );
+                    cursor = append( cursor, STRAN, NTENS * sizeof( double ) );
+                    append( cursor, DSTRAN, NTENS * sizeof( double ) );
+                } );
+            }
+
+    };
+
+    class VUMATRecorder : public TraceRecorder{
+        /*!
+         * Append the blocks of VUMAT calls to a binary trace file. Replay the trace with ``VUMATTrace`` or the
+         * ``replay_tardigrade_abaqus_tools`` executable. See ``TraceRecorder`` for the thread safety and failure
+         * handling.
+         *
+         * In a VUMAT, record through ``recordVUMAT``, which is enabled by the ``TARDIGRADE_ABAQUS_TOOLS_TRACE_FILE``
+         * environment variable.
+         */
+
+        public:
+
+            explicit VUMATRecorder( const std::string &filename ) :
+                TraceRecorder( filename, vumatTraceMagic, vumatTraceVersion, "VUMAT" ){
+                /*!
+                 * \param &filename: The trace file. Existing files are overwritten.
+                 */
+            }
+
+            void record( const double *stressOld, const double *stateOld, const double *strainInc, const int &nblock,
+                         const int &ndir, const int &nshr, const int &nstatev, const char *cmname,
+                         const int &cmname_length ){
+                /*!
+                 * Append one VUMAT call to the trace
+                 *
+                 * \param *stressOld: The VUMAT ``stressOld(nblock, ndir + nshr)`` block
+                 * \param *stateOld: The VUMAT ``stateOld(nblock, nstatev)`` block
+                 * \param *strainInc: The VUMAT ``strainInc(nblock, ndir + nshr)`` block
+                 * \param &nblock: The number of material points in the block
+                 * \param &ndir: The number of direct components.
+                 * \param &nshr: The number of shear components.
+                 * \param &nstatev: The number of state variables.
+                 * \param *cmname: The Fortran material name
+                 * \param &cmname_length: The length of the Fortran material name, e.g. 80
+                 */
+                checkNTENS( ndir, nshr );
+                const int ntens = ndir + nshr;
+                const std::string_view name = FtoStringView( cmname_length, cmname );
+                const VUMATTraceRecordHeader header{ nblock, ndir, nshr, nstatev, static_cast< std::int32_t >( name.size( ) ), 0 };
+                const std::size_t stress_bytes = sizeof( double ) * std::size_t( nblock ) * ntens;
+                const std::size_t state_bytes = sizeof( double ) * std::size_t( nblock ) * nstatev;
+
+                write( vumatTraceRecordSize( nblock, ntens, nstatev, header.cmname_length ), [ & ]( char *cursor ){
+                    cursor = append( cursor, &header, sizeof( header ) );
+                    append( cursor, name.data( ), name.size( ) );
+                    cursor += umatTracePadding( name.size( ) );
+                    cursor = append( cursor, stressOld, stress_bytes );
+                    cursor = append( cursor, stateOld, state_bytes );
+                    append( cursor, strainInc, stress_bytes );
+                } );
+            }
+
+    };
+
+    inline std::string processTraceFilename( const std::string &pattern, const long &pid = ::getpid( ) ){
+        /*!
+         * Make a trace file name unique to the process, so that the ranks of an MPI parallel analysis do not truncate
+         * and interleave a shared file. Every ``%p`` in the pattern is replaced by the process ID. Patterns without a
+         * ``%p`` get the process ID appended as ``.<pid>``.
+         *
+         * \param &pattern: The trace file name pattern, e.g. ``job.%p.trace``
+         * \param &pid: The process ID. Default: the calling process.
+         * \returns The trace file name of the process
+         */
+        const std::string id = std::to_string( pid );
+        std::string filename;
+        bool expanded = false;
+        for ( std::size_t index = 0; index < pattern.size( ); index++ ){
+            if ( pattern[ index ] == '%' && index + 1 < pattern.size( ) && pattern[ index + 1 ] == 'p' ){
+                filename += id;
+                expanded = true;
+                index++;
+            }
+            else{
+                filename += pattern[ index ];
+            }
+        }
+        return expanded ? filename : filename + "." + id;
+    }
+
+    template< class Recorder = UMATRecorder >
+    inline std::unique_ptr< Recorder > openTraceRecorder( const char *pattern ){
+        /*!
+         * Open the recorder of the process for a trace file name pattern without throwing. A trace file that cannot be
+         * opened is reported once on ``std::cerr`` and disables recording.
+         *
+         * \param Recorder: The recorder type, ``UMATRecorder`` or ``VUMATRecorder``. Default: ``UMATRecorder``.
+         * \param *pattern: The trace file name pattern, see ``processTraceFilename``. May be null.
+         * \returns The recorder or a null pointer when the pattern is null or the file could not be opened
+         */
+        if ( pattern == nullptr ){
+            return nullptr;
+        }
+        try{
+            return std::make_unique< Recorder >( processTraceFilename( pattern ) );
+        }
+        catch ( const std::exception &error ){
+            std::cerr << error.what( ) << ". Recording stopped.\n";
+            return nullptr;
+        }
+    }
+
+    inline UMATRecorder *environmentRecorder( ){
+        /*!
+         * The process wide recorder writing to the file named by the ``TARDIGRADE_ABAQUS_TOOLS_TRACE_FILE`` environment
+         * variable, made unique to the process by ``processTraceFilename``. The variable is read on the first call, so
+         * a file that cannot be opened is not retried by later UMAT calls.
+         *
+         * \returns The recorder or a null pointer when the variable is not set or the file could not be opened
+         */
+        static const std::unique_ptr< UMATRecorder > recorder =
+            openTraceRecorder< UMATRecorder >( std::getenv( "TARDIGRADE_ABAQUS_TOOLS_TRACE_FILE" ) );
+        return recorder.get( );
+    }
+
+    inline VUMATRecorder *environmentVUMATRecorder( ){
+        /*!
+         * The process wide VUMAT recorder. See ``environmentRecorder``. An analysis calls either UMATs or VUMATs, so
+         * both recorders use the ``TARDIGRADE_ABAQUS_TOOLS_TRACE_FILE`` name.
+         *
+         * \returns The recorder or a null pointer when the variable is not set or the file could not be opened
+         */
+        static const std::unique_ptr< VUMATRecorder > recorder =
+            openTraceRecorder< VUMATRecorder >( std::getenv( "TARDIGRADE_ABAQUS_TOOLS_TRACE_FILE" ) );
+        return recorder.get( );
+    }
+
+    inline void recordUMAT( const double *STRESS, const double *STATEV, const double *DDSDDE, const double *STRAN,
+                            const double *DSTRAN, const int &NDI, const int &NSHR, const int &NSTATV,
+                            const char *CMNAME, const int &CMNAME_length ){
+        /*!
+         * Record the UMAT arguments when the ``TARDIGRADE_ABAQUS_TOOLS_TRACE_FILE`` environment variable is set. Costs
+         * one branch otherwise. Call at the start of the UMAT, e.g.
+         *
+         *     tardigradeAbaqusTools::recordUMAT( STRESS, STATEV, DDSDDE, STRAN, DSTRAN, *NDI, *NSHR, *NSTATV,
+         *                                        CMNAME, CMNAME_length );
+         *
+         * \param *STRESS: The UMAT ``STRESS`` array. Length NDI + NSHR.
+         * \param *STATEV: The UMAT ``STATEV`` array. Length NSTATV.
+         * \param *DDSDDE: The UMAT ``DDSDDE`` array. Length ( NDI + NSHR ) * ( NDI + NSHR ).
+         * \param *STRAN: The UMAT ``STRAN`` array. Length NDI + NSHR.
+         * \param *DSTRAN: The UMAT ``DSTRAN`` array. Length NDI + NSHR.
+         * \param &NDI: The number of direct components.
+         * \param &NSHR: The number of shear components.
+         * \param &NSTATV: The number of state variables.
+         * \param *CMNAME: The Fortran material name
+         * \param &CMNAME_length: The length of the Fortran material name, e.g. 80
+         */
+        UMATRecorder *recorder = environmentRecorder( );
+        if ( recorder != nullptr ){
+            recorder->record( STRESS, STATEV, DDSDDE, STRAN, DSTRAN, NDI, NSHR, NSTATV, CMNAME, CMNAME_length );
+        }
+    }
+
+    inline void recordVUMAT( const double *stressOld, const double *stateOld, const double *strainInc,
+                             const int &nblock, const int &ndir, const int &nshr, const int &nstatev,
+                             const char *cmname, const int &cmname_length ){
+        /*!
+         * Record the VUMAT blocks when the ``TARDIGRADE_ABAQUS_TOOLS_TRACE_FILE`` environment variable is set. Costs
+         * one branch otherwise. Call at the start of the VUMAT, e.g.
+         *
+         *     tardigradeAbaqusTools::recordVUMAT( stressOld, stateOld, strainInc, *nblock, *ndir, *nshr, *nstatev,
+         *                                         cmname, cmname_length );
+         *
+         * \param *stressOld: The VUMAT ``stressOld(nblock, ndir + nshr)`` block
+         * \param *stateOld: The VUMAT ``stateOld(nblock, nstatev)`` block
+         * \param *strainInc: The VUMAT ``strainInc(nblock, ndir + nshr)`` block
+         * \param &nblock: The number of material points in the block
+         * \param &ndir: The number of direct components.
+         * \param &nshr: The number of shear components.
+         * \param &nstatev: The number of state variables.
+         * \param *cmname: The Fortran material name
+         * \param &cmname_length: The length of the Fortran material name, e.g. 80
+         */
+        VUMATRecorder *recorder = environmentVUMATRecorder( );
+        if ( recorder != nullptr ){
+            recorder->record( stressOld, stateOld, strainInc, nblock, ndir, nshr, nstatev, cmname, cmname_length );
+        }
+    }
+
+    inline bool isVUMATTrace( const std::string &filename ){
+        /*!
+         * \param &filename: A trace file
+         * \returns True if the file starts with the VUMAT trace identifier
+         */
+        char magic[ 8 ] = { };
+        std::ifstream file( filename, std::ios::binary );
+        file.read( magic, sizeof( magic ) );
+        return file && std::equal( std::begin( vumatTraceMagic ), std::end( vumatTraceMagic ), magic );
+    }
+
+    inline void checkTraceFileHeader( const MappedFile &file, const std::string &filename, const char ( &magic )[ 8 ],
+                                      const std::uint32_t &version, const std::string &kind ){
+        /*!
+         * Reject mapped files that do not start with the header of a trace of the given type
+         *
+         * \param &file: The mapped trace
+         * \param &filename: The trace file name for the messages
+         * \param &magic: The identifier of the trace type
+         * \param &version: The supported trace format version
+         * \param &kind: The name of the recorded subroutine in messages, e.g. UMAT
+         */
+        if ( file.size( ) < sizeof( UMATTraceFileHeader ) ){
+            throw std::runtime_error( filename + " is not a " + kind + " trace" );
+        }
+        UMATTraceFileHeader header;
+        std::memcpy( &header, file.data( ), sizeof( header ) );
+        if ( !std::equal( std::begin( magic ), std::end( magic ), header.magic ) ){
+            throw std::runtime_error( filename + " is not a " + kind + " trace" );
+        }
+        if ( header.version != version ){
+            throw std::runtime_error( filename + " has the unsupported " + kind + " trace version " + std::to_string( header.version ) );
+        }
+        if ( header.scalar_size != sizeof( double ) ){
+            throw std::runtime_error( filename + " was not recorded with double precision values" );
+        }
+    }
+
+    struct UMATTraceRecord{
+        /*!
+         * One recorded UMAT call. The arrays point into the mapped trace and are read only.
+         */
+
+        int NDI;
+
+        int NSHR;
+
+        int NSTATV;
+
+        std::string_view CMNAME;
+
+        const double *STRESS;
+
+        const double *STATEV;
+
+        const double *DDSDDE;
+
+        const double *STRAN;
+
+        const double *DSTRAN;
+
+        int NTENS( ) const{
+            /*!
+             * \returns The number of contracted components
+             */
+            return NDI + NSHR;
+        }
+
+    };
+
+    class UMATTrace{
+        /*!
+         * Read a UMAT trace written by ``UMATRecorder``. The file is memory mapped and the records are indexed once at
+         * construction; the record arrays point directly into the mapping.
+         */
+
+        public:
+
+            explicit UMATTrace( const std::string &filename ) : _file( filename ){
+                /*!
+                 * \param &filename: The trace file
+                 */
+                checkTraceFileHeader( _file, filename, umatTraceMagic, umatTraceVersion, "UMAT" );
+
+                std::size_t offset = sizeof( UMATTraceFileHeader );
+                while ( offset < _file.size( ) ){
+                    if ( _file.size( ) - offset < sizeof( UMATTraceRecordHeader ) ){
+                        throw std::runtime_error( filename + " is truncated" );
+                    }
+                    UMATTraceRecordHeader record;
+                    std::memcpy( &record, _file.data( ) + offset, sizeof( record ) );
+                    if ( record.NDI < 1 || record.NDI > 3 || record.NSHR < 0 || record.NSHR > 3 || record.NSTATV < 0 ||
+                         record.CMNAME_length < 0 ){
+                        throw std::runtime_error( filename + " has a corrupt record at byte " + std::to_string( offset ) );
+                    }
+                    const std::size_t size = umatTraceRecordSize( record.NDI + record.NSHR, record.NSTATV, record.CMNAME_length );
+                    if ( _file.size( ) - offset < size ){
+                        throw std::runtime_error( filename + " is truncated" );
+                    }
+                    _offsets.push_back( offset );
+                    offset += size;
+                }
+            }
+
+            std::size_t size( ) const{
+                /*!
+                 * \returns The number of recorded UMAT calls
+                 */
+                return _offsets.size( );
+            }
+
+            UMATTraceRecord operator[]( const std::size_t &index ) const{
+                /*!
+                 * \param &index: The record index
+                 * \returns The recorded UMAT call
+                 */
+                const char *cursor = _file.data( ) + _offsets[ index ];
+                UMATTraceRecordHeader header;
+                std::memcpy( &header, cursor, sizeof( header ) );
+                cursor += sizeof( header );
+
+                const int NTENS = header.NDI + header.NSHR;
+                UMATTraceRecord record;
+                record.NDI = header.NDI;
+                record.NSHR = header.NSHR;
+                record.NSTATV = header.NSTATV;
+                record.CMNAME = std::string_view( cursor, header.CMNAME_length );
+                cursor += umatTracePadding( header.CMNAME_length );
+                record.STRESS = reinterpret_cast< const double* >( cursor );
+                record.STATEV = record.STRESS + NTENS;
+                record.DDSDDE = record.STATEV + header.NSTATV;
+                record.STRAN = record.DDSDDE + NTENS * NTENS;
+                record.DSTRAN = record.STRAN + NTENS;
+                return record;
+            }
+
+        private:
+
+            MappedFile _file;
+
+            std::vector< std::size_t > _offsets;
+
+    };
+
+    struct UMATReplayCall{
+        /*!
+         * The writable arguments of a replayed UMAT call. ``STRESS``, ``STATEV``, and ``DDSDDE`` are copies of the
+         * recorded values that the model may update in place, as in Abaqus.
+         */
+
+        int NDI;
+
+        int NSHR;
+
+        int NSTATV;
+
+        std::string_view CMNAME;
+
+        double *STRESS;
+
+        double *STATEV;
+
+        double *DDSDDE;
+
+        const double *STRAN;
+
+        const double *DSTRAN;
+
+    };
+
+    template< class Function >
+    inline void replayUMATTrace( const UMATTrace &trace, Function &&model ){
+        /*!
+         * Call a model once per recorded UMAT call in the recorded order. The model is called as
+         * ``model( UMATReplayCall &call )``. The writable arrays are reused between calls, so replays allocate only when
+         * a record is larger than all previous records.
+         *
+         * \param &trace: The recorded UMAT calls
+         * \param &&model: The model, e.g. a wrapper of the UMAT implementation or the conversions under test
+         */
+        std::vector< double > buffer;
+        for ( std::size_t index = 0; index < trace.size( ); index++ ){
+            const UMATTraceRecord record = trace[ index ];
+            const int NTENS = record.NTENS( );
+            const std::size_t length = std::size_t( NTENS ) * ( NTENS + 1 ) + std::size_t( record.NSTATV );
+            if ( buffer.size( ) < length ){
+                buffer.resize( length );
+            }
+            std::copy( record.STRESS, record.STRESS + length, buffer.data( ) );
+
+            UMATReplayCall call{ record.NDI, record.NSHR, record.NSTATV, record.CMNAME, buffer.data( ),
+                                 buffer.data( ) + NTENS, buffer.data( ) + NTENS + record.NSTATV, record.STRAN,
+                                 record.DSTRAN };
+            model( call );
+        }
+    }
+
+    struct VUMATTraceRecord{
+        /*!
+         * One recorded VUMAT call. The blocks are column major with one row per material point, point into the mapped
+         * trace, and are read only.
+         */
+
+        int nblock;
+
+        int ndir;
+
+        int nshr;
+
+        int nstatev;
+
+        std::string_view cmname;
+
+        const double *stressOld;
+
+        const double *stateOld;
+
+        const double *strainInc;
+
+        int ntens( ) const{
+            /*!
+             * \returns The number of contracted components
+             */
+            return ndir + nshr;
+        }
+
+    };
+
+    class VUMATTrace{
+        /*!
+         * Read a VUMAT trace written by ``VUMATRecorder``. The file is memory mapped and the records are indexed once at
+         * construction; the record blocks point directly into the mapping.
+         */
+
+        public:
+
+            explicit VUMATTrace( const std::string &filename ) : _file( filename ){
+                /*!
+                 * \param &filename: The trace file
+                 */
+                checkTraceFileHeader( _file, filename, vumatTraceMagic, vumatTraceVersion, "VUMAT" );
+
+                std::size_t offset = sizeof( UMATTraceFileHeader );
+                while ( offset < _file.size( ) ){
+                    if ( _file.size( ) - offset < sizeof( VUMATTraceRecordHeader ) ){
+                        throw std::runtime_error( filename + " is truncated" );
+                    }
+                    VUMATTraceRecordHeader record;
+                    std::memcpy( &record, _file.data( ) + offset, sizeof( record ) );
+                    if ( record.nblock < 0 || record.ndir < 1 || record.ndir > 3 || record.nshr < 0 || record.nshr > 3 ||
+                         record.nstatev < 0 || record.cmname_length < 0 ){
+                        throw std::runtime_error( filename + " has a corrupt record at byte " + std::to_string( offset ) );
+                    }
+                    const std::size_t size = vumatTraceRecordSize( record.nblock, record.ndir + record.nshr, record.nstatev,
+                                                                   record.cmname_length );
+                    if ( _file.size( ) - offset < size ){
+                        throw std::runtime_error( filename + " is truncated" );
+                    }
+                    _offsets.push_back( offset );
+                    offset += size;
+                }
+            }
+
+            std::size_t size( ) const{
+                /*!
+                 * \returns The number of recorded VUMAT calls
+                 */
+                return _offsets.size( );
+            }
+
+            VUMATTraceRecord operator[]( const std::size_t &index ) const{
+                /*!
+                 * \param &index: The record index
+                 * \returns The recorded VUMAT call
+                 */
+                const char *cursor = _file.data( ) + _offsets[ index ];
+                VUMATTraceRecordHeader header;
+                std::memcpy( &header, cursor, sizeof( header ) );
+                cursor += sizeof( header );
+
+                const std::size_t nblock = header.nblock;
+                VUMATTraceRecord record;
+                record.nblock = header.nblock;
+                record.ndir = header.ndir;
+                record.nshr = header.nshr;
+                record.nstatev = header.nstatev;
+                record.cmname = std::string_view( cursor, header.cmname_length );
+                cursor += umatTracePadding( header.cmname_length );
+                record.stressOld = reinterpret_cast< const double* >( cursor );
+                record.stateOld = record.stressOld + nblock * record.ntens( );
+                record.strainInc = record.stateOld + nblock * header.nstatev;
+                return record;
+            }
+
+        private:
+
+            MappedFile _file;
+
+            std::vector< std::size_t > _offsets;
+
+    };
+
+    struct VUMATReplayCall{
+        /*!
+         * The arguments of a replayed VUMAT call. ``stressNew`` and ``stateNew`` are writable blocks that start as copies
+         * of the recorded ``stressOld`` and ``stateOld`` blocks.
+         */
+
+        int nblock;
+
+        int ndir;
+
+        int nshr;
+
+        int nstatev;
+
+        std::string_view cmname;
+
+        const double *stressOld;
+
+        const double *stateOld;
+
+        const double *strainInc;
+
+        double *stressNew;
+
+        double *stateNew;
+
+    };
+
+    template< class Function >
+    inline void replayVUMATTrace( const VUMATTrace &trace, Function &&model ){
+        /*!
+         * Call a model once per recorded VUMAT call in the recorded order. The model is called as
+         * ``model( VUMATReplayCall &call )``. The writable blocks are reused between calls, so replays allocate only when
+         * a record is larger than all previous records.
+         *
+         * \param &trace: The recorded VUMAT calls
+         * \param &&model: The model, e.g. a wrapper of the VUMAT implementation or the conversions under test
+         */
+        std::vector< double > buffer;
+        for ( std::size_t index = 0; index < trace.size( ); index++ ){
+            const VUMATTraceRecord record = trace[ index ];
+            const std::size_t stress_length = std::size_t( record.nblock ) * record.ntens( );
+            const std::size_t length = stress_length + std::size_t( record.nblock ) * record.nstatev;
+            if ( buffer.size( ) < length ){
+                buffer.resize( length );
+            }
+            //The stressOld and stateOld blocks are adjacent in the record
+            std::copy( record.stressOld, record.stressOld + length, buffer.data( ) );
+
+            VUMATReplayCall call{ record.nblock, record.ndir, record.nshr, record.nstatev, record.cmname, record.stressOld,
+                                  record.stateOld, record.strainInc, buffer.data( ), buffer.data( ) + stress_length };
+            model( call );
+        }
+    }
+
+    //! Identifies a state snapshot file
+    constexpr char snapshotMagic[ 8 ] = { 'T', 'A', 'T', 'S', 'N', 'A', 'P', '\0' };
+
+    //! Version of the state snapshot format
+    constexpr std::uint32_t snapshotVersion = 1;
+
+    struct SnapshotFileHeader{
+        /*!
+         * The header at the start of a state snapshot file
+         */
+
+        char magic[ 8 ];
+
+        //! The snapshot format version
+        std::uint32_t version;
+
+        //! The size of the stored floating point values in bytes
+        std::uint32_t scalar_size;
+
+        std::int32_t NDI;
+
+        std::int32_t NSHR;
+
+        std::int32_t NSTATV;
+
+        //! The ``AbaqusSolver`` packing order of the stress components
+        std::int32_t solver;
+
+    };
+
+    struct SnapshotChunkHeader{
+        /*!
+         * The header of each snapshot chunk. The header is followed by the ``npoints x NTENS`` stress and the
+         * ``npoints x NSTATV`` state variable columns of the chunk, both column major, so each component of the chunk is
+         * a contiguous column.
+         */
+
+        std::uint64_t npoints;
+
+    };
+
+    static_assert( sizeof( SnapshotFileHeader ) == 32, "The snapshot file header must be 32 bytes" );
+    static_assert( sizeof( SnapshotChunkHeader ) == 8, "The snapshot chunk header must be 8 bytes" );
+
+    class SnapshotWriter{
+        /*!
+         * Stream the stress and state variables of a whole model to a columnar binary snapshot, e.g. for restart
+         * debugging or post-processing. The points are written in chunks of one block each, and the chunks are read
+         * back without copies by ``SnapshotReader``.
+         *
+         * Blocks that are already columnar, e.g. the VUMAT ``stressNew(nblock, NTENS)`` and ``stateNew(nblock, nstatev)``
+         * arrays, are written directly from the Abaqus memory. Point major blocks, e.g. ``STRESS(NTENS, NPT)`` and
+         * ``STATEV(NSTATV, NPT)`` arrays gathered from UMAT calls, are transposed through a reused buffer with the
+         * blocked ``rowToColumnMajor`` conversion. Not thread safe.
+         */
+
+        public:
+
+            SnapshotWriter( const std::string &filename, const int &NDI, const int &NSHR, const int &NSTATV,
+                            const AbaqusSolver &solver = AbaqusSolver::Standard ) :
+                _file( filename, std::ios::binary | std::ios::trunc ), _NTENS( NDI + NSHR ), _NSTATV( NSTATV ){
+                /*!
+                 * \param &filename: The snapshot file. Existing files are overwritten.
+                 * \param &NDI: The number of direct components.
+                 * \param &NSHR: The number of shear components.
+                 * \param &NSTATV: The number of state variables.
+                 * \param &solver: The packing order of the stress components. Default: Abaqus/Standard.
+                 */
+                checkNTENS( NDI, NSHR );
+                if ( NSTATV < 0 ){
+                    throw std::invalid_argument( "NSTATV must not be negative" );
+                }
+                if ( !_file ){
+                    throw std::runtime_error( "Could not open the snapshot file " + filename );
+                }
+                SnapshotFileHeader header{ };
+                std::copy( std::begin( snapshotMagic ), std::end( snapshotMagic ), header.magic );
+                header.version = snapshotVersion;
+                header.scalar_size = sizeof( double );
+                header.NDI = NDI;
+                header.NSHR = NSHR;
+                header.NSTATV = NSTATV;
+                header.solver = static_cast< std::int32_t >( solver );
+                _file.write( reinterpret_cast< const char* >( &header ), sizeof( header ) );
+            }
+
+            void writeBlock( const double *stress, const double *state, const int &nblock ){
+                /*!
+                 * Append a columnar block of points without copies
+                 *
+                 * \param *stress: The column major ``nblock x NTENS`` stress array, e.g. the VUMAT ``stressNew`` pointer
+                 * \param *state: The column major ``nblock x NSTATV`` state variable array, e.g. the VUMAT ``stateNew``
+                 *     pointer
+                 * \param &nblock: The number of points in the block
+                 */
+                writeChunk( stress, state, nblock );
+            }
+
+            void writePoints( const double *STRESS, const double *STATEV, const int &npoints ){
+                /*!
+                 * Append a point major block of points
+                 *
+                 * \param *STRESS: The column major ``NTENS x npoints`` stress array
+                 * \param *STATEV: The column major ``NSTATV x npoints`` state variable array
+                 * \param &npoints: The number of points in the block
+                 */
+                _buffer.resize( static_cast< std::size_t >( npoints ) * ( _NTENS + _NSTATV ) );
+                double *stress = _buffer.data( );
+                double *state = stress + static_cast< std::size_t >( npoints ) * _NTENS;
+
+                //A column major NTENS x npoints array is a row major npoints x NTENS array
+                rowToColumnMajor( stress, STRESS, npoints, _NTENS );
+                rowToColumnMajor( state, STATEV, npoints, _NSTATV );
+                writeChunk( stress, state, npoints );
+            }
+
+            std::size_t npoints( ) const{
+                /*!
+                 * \returns The number of points written
+                 */
+                return _npoints;
+            }
+
+            void close( ){
+                /*!
+                 * Flush and close the snapshot. Called by the destructor.
+                 */
+                if ( _file.is_open( ) ){
+                    _file.close( );
+                    if ( _file.fail( ) ){
+                        throw std::runtime_error( "Could not write the snapshot file" );
+                    }
+                }
+            }
+
+            ~SnapshotWriter( ){
+                try{
+                    close( );
+                }
+                catch ( const std::exception &error ){
+                    std::cerr << error.what( ) << "\n";
+                }
+            }
+
+        private:
+
+            void writeChunk( const double *stress, const double *state, const int &npoints ){
+                if ( npoints < 0 ){
+                    throw std::invalid_argument( "The number of points must not be negative" );
+                }
+                const SnapshotChunkHeader header{ static_cast< std::uint64_t >( npoints ) };
+                _file.write( reinterpret_cast< const char* >( &header ), sizeof( header ) );
+                _file.write( reinterpret_cast< const char* >( stress ), static_cast< std::size_t >( npoints ) * _NTENS * sizeof( double ) );
+                _file.write( reinterpret_cast< const char* >( state ), static_cast< std::size_t >( npoints ) * _NSTATV * sizeof( double ) );
+                if ( !_file ){
+                    throw std::runtime_error( "Could not write the snapshot file" );
+                }
+                _npoints += npoints;
+            }
+
+            std::ofstream _file;
+
+            int _NTENS;
+
+            int _NSTATV;
+
+            std::size_t _npoints = 0;
+
+            std::vector< double > _buffer;
+
+    };
+
+    struct SnapshotChunk{
+        /*!
+         * One chunk of a state snapshot. The views point into the mapped snapshot and are read only.
+         */
+
+        //! The index of the first point of the chunk in the snapshot
+        std::size_t first_point;
+
+        //! The ``npoints x NTENS`` stress components
+        ColumnMajorView< const double > stress;
+
+        //! The ``npoints x NSTATV`` state variables
+        ColumnMajorView< const double > state;
+
+        int npoints( ) const{
+            /*!
+             * \returns The number of points in the chunk
+             */
+            return stress.height( );
+        }
+
+    };
+
+    class SnapshotReader{
+        /*!
+         * Read a state snapshot written by ``SnapshotWriter``. The file is memory mapped and the chunks are indexed once
+         * at construction; the chunk views point directly into the mapping.
+         */
+
+        public:
+
+            explicit SnapshotReader( const std::string &filename ) : _file( filename ){
+                /*!
+                 * \param &filename: The snapshot file
+                 */
+                if ( _file.size( ) < sizeof( SnapshotFileHeader ) ){
+                    throw std::runtime_error( filename + " is not a state snapshot" );
+                }
+                std::memcpy( &_header, _file.data( ), sizeof( _header ) );
+                if ( !std::equal( std::begin( snapshotMagic ), std::end( snapshotMagic ), _header.magic ) ){
+                    throw std::runtime_error( filename + " is not a state snapshot" );
+                }
+                if ( _header.version != snapshotVersion ){
+                    throw std::runtime_error( filename + " has the unsupported snapshot version " + std::to_string( _header.version ) );
+                }
+                if ( _header.scalar_size != sizeof( double ) ){
+                    throw std::runtime_error( filename + " was not written with double precision values" );
+                }
+                if ( _header.NDI < 1 || _header.NDI > 3 || _header.NSHR < 0 || _header.NSHR > 3 || _header.NSTATV < 0 ||
+                     ( _header.solver != static_cast< std::int32_t >( AbaqusSolver::Standard ) &&
+                       _header.solver != static_cast< std::int32_t >( AbaqusSolver::Explicit ) ) ){
+                    throw std::runtime_error( filename + " has a corrupt header" );
+                }
+
+                const std::size_t point_size = sizeof( double ) * ( NTENS( ) + NSTATV( ) );
+                std::size_t offset = sizeof( SnapshotFileHeader );
+                while ( offset < _file.size( ) ){
+                    if ( _file.size( ) - offset < sizeof( SnapshotChunkHeader ) ){
+                        throw std::runtime_error( filename + " is truncated" );
+                    }
+                    SnapshotChunkHeader chunk;
+                    std::memcpy( &chunk, _file.data( ) + offset, sizeof( chunk ) );
+                    if ( chunk.npoints > ( _file.size( ) - offset - sizeof( chunk ) ) / std::max( point_size, std::size_t( 1 ) ) ){
+                        throw std::runtime_error( filename + " is truncated" );
+                    }
+                    if ( chunk.npoints > static_cast< std::uint64_t >( std::numeric_limits< int >::max( ) ) ){
+                        throw std::runtime_error( filename + " has a chunk with more points than the chunk views can index" );
+                    }
+                    _offsets.push_back( offset );
+                    _first_points.push_back( _npoints );
+                    _npoints += chunk.npoints;
+                    offset += sizeof( chunk ) + chunk.npoints * point_size;
+                }
+            }
+
+            int NDI( ) const{
+                /*!
+                 * \returns The number of direct components
+                 */
+                return _header.NDI;
+            }
+
+            int NSHR( ) const{
+                /*!
+                 * \returns The number of shear components
+                 */
+                return _header.NSHR;
+            }
+
+            int NTENS( ) const{
+                /*!
+                 * \returns The number of stress components
+                 */
+                return _header.NDI + _header.NSHR;
+            }
+
+            int NSTATV( ) const{
+                /*!
+                 * \returns The number of state variables
+                 */
+                return _header.NSTATV;
+            }
+
+            AbaqusSolver solver( ) const{
+                /*!
+                 * \returns The packing order of the stress components
+                 */
+                return static_cast< AbaqusSolver >( _header.solver );
+            }
+
+            std::size_t npoints( ) const{
+                /*!
+                 * \returns The number of points in the snapshot
+                 */
+                return _npoints;
+            }
+
+            std::size_t size( ) const{
+                /*!
+                 * \returns The number of chunks
+                 */
+                return _offsets.size( );
+            }
+
+            SnapshotChunk operator[]( const std::size_t &index ) const{
+                /*!
+                 * \param &index: The chunk index
+                 * \returns The chunk
+                 */
+                const char *cursor = _file.data( ) + _offsets[ index ];
+                SnapshotChunkHeader header;
+                std::memcpy( &header, cursor, sizeof( header ) );
+                const int npoints = static_cast< int >( header.npoints );
+                const double *stress = reinterpret_cast< const double* >( cursor + sizeof( header ) );
+                const double *state = stress + static_cast< std::size_t >( npoints ) * NTENS( );
+                return SnapshotChunk{ _first_points[ index ], ColumnMajorView< const double >( stress, npoints, NTENS( ) ),
+                                      ColumnMajorView< const double >( state, npoints, NSTATV( ) ) };
+            }
+
+            std::size_t findChunk( const std::size_t &point ) const{
+                /*!
+                 * \param &point: The index of a point in the snapshot
+                 * \returns The index of the chunk containing the point
+                 */
+                if ( point >= _npoints ){
+                    throw std::out_of_range( "The point is not in the snapshot" );
+                }
+                return std::upper_bound( _first_points.begin( ), _first_points.end( ), point ) - _first_points.begin( ) - 1;
+            }
+
+            std::array< double, 9 > stressTensor( const std::size_t &point ) const{
+                /*!
+                 * Expand the stress of one point into a full 3x3 tensor with the packing order of the snapshot
+                 *
+                 * \param &point: The index of the point in the snapshot
+                 * \returns The row major full stress tensor
+                 */
+                const SnapshotChunk chunk = ( *this )[ findChunk( point ) ];
+                const int row = static_cast< int >( point - chunk.first_point );
+                std::array< double, 6 > stress{ };
+                for ( int component = 0; component < NTENS( ); component++ ){
+                    stress[ component ] = chunk.stress( row, component );
+                }
+                std::array< double, 9 > full_tensor;
+                expandFullNTENSTensor( full_tensor, ColumnMajorView< const double >( stress.data( ), NTENS( ), 1 ), NDI( ), NSHR( ),
+                                       solver( ) == AbaqusSolver::Standard );
+                return full_tensor;
+            }
+
+        private:
+
+            MappedFile _file;
+
+            SnapshotFileHeader _header;
+
+            std::vector< std::size_t > _offsets;
+
+            std::vector< std::size_t > _first_points;
+
+            std::size_t _npoints = 0;
+
+    };
+
+}
+
+#endif
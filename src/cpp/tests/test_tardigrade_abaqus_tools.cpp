@@ -8,6 +8,9 @@
 #define BOOST_TEST_MODULE test_tardigrade_abaqus_tools
 #include <boost/test/included/unit_test.hpp>
 
+#include<sstream>
+#include<cmath>
+
 #include<tardigrade_vector_tools.h>
 
 #include<tardigrade_abaqus_tools.h>
@@ -293,3 +296,1720 @@ BOOST_AUTO_TEST_CASE( testContractFullNTENSMatrix ){
                 boost::test_tools::per_element() );
 
 }
+
+BOOST_AUTO_TEST_CASE( testWriteIntoOverloads ){
+    /*!
+     * Test the overloads that write into preallocated outputs against the value-returning conversions
+     */
+
+    std::vector< double > full_abaqus_vector = { 1, 2, 3, 4, 5, 6 };
+    std::vector< std::vector< double > > full_abaqus_matrix( 6, std::vector< double >( 6 ) );
+    for ( unsigned int row = 0; row < 6; row++ ){
+        for ( unsigned int col = 0; col < 6; col++ ){
+            full_abaqus_matrix[ row ][ col ] = 10 * ( row + 1 ) + col + 1;
+        }
+    }
+
+    //Buffers allocated once and reused for every case
+    std::vector< double > vector_buffer( 6 );
+    std::vector< double > tensor_buffer( 9 );
+    std::array< double, 6 > array_buffer;
+    std::vector< std::vector< double > > matrix_buffer( 6, std::vector< double >( 6 ) );
+    std::vector< std::vector< double > > full_matrix_buffer( 9, std::vector< double >( 9 ) );
+    double DDSDDE[ 36 ];
+
+    for ( bool abaqus_standard : { true, false } ){
+        std::vector< double > full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( full_abaqus_vector, abaqus_standard );
+        tardigradeAbaqusTools::expandFullNTENSTensor( tensor_buffer, full_abaqus_vector, abaqus_standard );
+        BOOST_TEST( tensor_buffer == full_tensor, boost::test_tools::per_element() );
+
+        tardigradeAbaqusTools::contractFullNTENSTensor( array_buffer, full_tensor, abaqus_standard );
+        BOOST_TEST( std::vector< double >( array_buffer.begin( ), array_buffer.end( ) ) == full_abaqus_vector,
+                    boost::test_tools::per_element() );
+
+        std::vector< std::vector< double > > full_matrix = tardigradeAbaqusTools::expandFullNTENSMatrix( full_abaqus_matrix,
+                                                                                                         abaqus_standard );
+        tardigradeAbaqusTools::expandFullNTENSMatrix( full_matrix_buffer, full_abaqus_matrix, abaqus_standard );
+        BOOST_TEST( full_matrix_buffer == full_matrix );
+
+        tardigradeAbaqusTools::contractFullNTENSMatrix( matrix_buffer, full_matrix, abaqus_standard );
+        BOOST_TEST( matrix_buffer == full_abaqus_matrix );
+
+        for ( const auto &[ NDI, NSHR ] : std::vector< std::pair< int, int > >{ { 3, 3 }, { 3, 1 }, { 2, 1 } } ){
+            const int NTENS = NDI + NSHR;
+
+            std::vector< double > abaqus_vector = tardigradeAbaqusTools::contractAbaqusNTENSVector( full_abaqus_vector, NDI, NSHR );
+            double STRESS[ 6 ] = { -666, -666, -666, -666, -666, -666 };
+            tardigradeAbaqusTools::ColumnMajorView< double > stress( STRESS, NTENS, 1 );
+            tardigradeAbaqusTools::contractAbaqusNTENSVector( stress, full_abaqus_vector, NDI, NSHR );
+            BOOST_TEST( std::vector< double >( STRESS, STRESS + NTENS ) == abaqus_vector, boost::test_tools::per_element() );
+
+            tardigradeAbaqusTools::expandAbaqusNTENSVector( vector_buffer, abaqus_vector, NDI, NSHR );
+            BOOST_TEST( vector_buffer == tardigradeAbaqusTools::expandAbaqusNTENSVector( abaqus_vector, NDI, NSHR ),
+                        boost::test_tools::per_element() );
+
+            std::fill( tensor_buffer.begin( ), tensor_buffer.end( ), -666 );
+            tardigradeAbaqusTools::expandFullNTENSTensor( tensor_buffer, stress, NDI, NSHR, abaqus_standard );
+            BOOST_TEST( tensor_buffer == tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_vector, NDI, NSHR, abaqus_standard ),
+                        boost::test_tools::per_element() );
+
+            std::fill( STRESS, STRESS + 6, -666 );
+            tardigradeAbaqusTools::contractFullNTENSTensor( stress, tensor_buffer, NDI, NSHR, abaqus_standard );
+            BOOST_TEST( std::vector< double >( STRESS, STRESS + NTENS ) == abaqus_vector, boost::test_tools::per_element() );
+
+            //Column major DDSDDE views as the matrix outputs and inputs
+            std::vector< std::vector< double > > abaqus_matrix = tardigradeAbaqusTools::contractAbaqusNTENSMatrix(
+                full_abaqus_matrix, NDI, NSHR );
+            tardigradeAbaqusTools::ColumnMajorView< double > ddsdde( DDSDDE, NTENS, NTENS );
+            tardigradeAbaqusTools::contractAbaqusNTENSMatrix( ddsdde, full_abaqus_matrix, NDI, NSHR );
+            BOOST_TEST( tardigradeAbaqusTools::columnToRowMajor( DDSDDE, NTENS, NTENS ) == abaqus_matrix );
+
+            std::vector< std::vector< double > > row_major( NTENS, std::vector< double >( NTENS ) );
+            tardigradeAbaqusTools::columnToRowMajor( DDSDDE, row_major, NTENS, NTENS );
+            BOOST_TEST( row_major == abaqus_matrix );
+
+            tardigradeAbaqusTools::expandAbaqusNTENSMatrix( matrix_buffer, ddsdde, NDI, NSHR );
+            BOOST_TEST( matrix_buffer == tardigradeAbaqusTools::expandAbaqusNTENSMatrix( abaqus_matrix, NDI, NSHR ) );
+
+            tardigradeAbaqusTools::expandFullNTENSMatrix( full_matrix_buffer, ddsdde, NDI, NSHR, abaqus_standard );
+            BOOST_TEST( full_matrix_buffer == tardigradeAbaqusTools::expandFullNTENSMatrix( abaqus_matrix, NDI, NSHR,
+                                                                                            abaqus_standard ) );
+
+            std::fill( DDSDDE, DDSDDE + 36, -666 );
+            tardigradeAbaqusTools::contractFullNTENSMatrix( ddsdde, full_matrix_buffer, NDI, NSHR, abaqus_standard );
+            BOOST_TEST( tardigradeAbaqusTools::columnToRowMajor( DDSDDE, NTENS, NTENS ) == abaqus_matrix );
+        }
+    }
+
+    //Undersized outputs are rejected
+    std::vector< double > short_vector( 5 );
+    std::vector< std::vector< double > > short_matrix( 6, std::vector< double >( 5 ) );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::expandAbaqusNTENSVector( short_vector, full_abaqus_vector, 3, 3 ),
+                       std::length_error );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::expandFullNTENSTensor( short_vector, full_abaqus_vector ), std::length_error );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::expandAbaqusNTENSMatrix( short_matrix, full_abaqus_matrix, 3, 3 ),
+                       std::length_error );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::columnToRowMajor( DDSDDE, short_matrix, 6, 6 ), std::length_error );
+
+}
+
+BOOST_AUTO_TEST_CASE( testSizeChecks ){
+    /*!
+     * Test the NDI, NSHR, and container size validation of the converters
+     */
+
+    BOOST_TEST( tardigradeAbaqusTools::checkSizes );
+
+    std::vector< double > full_abaqus_vector = { 1, 2, 3, 4, 5, 6 };
+    std::vector< double > full_tensor = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    std::vector< std::vector< double > > full_abaqus_matrix( 6, std::vector< double >( 6 ) );
+    std::array< double, 36 > full_abaqus_array = { };
+    double DDSDDE[ 36 ];
+
+    //Invalid NDI and NSHR combinations
+    for ( const auto &[ NDI, NSHR ] : std::vector< std::pair< int, int > >{ { 0, 3 }, { 4, 2 }, { 3, 4 }, { 2, -1 } } ){
+        BOOST_CHECK_THROW( tardigradeAbaqusTools::checkNTENS( NDI, NSHR ), std::invalid_argument );
+        BOOST_CHECK_THROW( tardigradeAbaqusTools::contractAbaqusNTENSVector( full_abaqus_vector, NDI, NSHR ),
+                           std::invalid_argument );
+        BOOST_CHECK_THROW( tardigradeAbaqusTools::contractFullNTENSTensor( full_tensor, NDI, NSHR ), std::invalid_argument );
+        BOOST_CHECK_THROW( tardigradeAbaqusTools::contractAbaqusNTENSMatrix( full_abaqus_matrix, NDI, NSHR ),
+                           std::invalid_argument );
+        BOOST_CHECK_THROW( tardigradeAbaqusTools::contractAbaqusNTENSMatrix( DDSDDE, full_abaqus_array, NDI, NSHR ),
+                           std::invalid_argument );
+        BOOST_CHECK_THROW( tardigradeAbaqusTools::lazyExpandFullNTENSTensor( full_abaqus_vector, NDI, NSHR ),
+                           std::invalid_argument );
+    }
+    BOOST_CHECK_NO_THROW( tardigradeAbaqusTools::checkNTENS( 1, 0 ) );
+    BOOST_CHECK_NO_THROW( tardigradeAbaqusTools::checkNTENS( 3, 3 ) );
+
+    //Short inputs
+    std::vector< double > short_vector( 3 );
+    std::vector< std::vector< double > > short_matrix( 6, std::vector< double >( 5 ) );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::expandAbaqusNTENSVector( short_vector, 3, 1 ), std::length_error );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::expandFullNTENSTensor( short_vector, 2, 2 ), std::length_error );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::expandFullNTENSTensor( short_vector ), std::length_error );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::contractFullNTENSTensor( full_abaqus_vector ), std::length_error );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::contractAbaqusNTENSVector( short_vector, 2, 1 ), std::length_error );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::contractAbaqusNTENSMatrix( short_matrix, 3, 3 ), std::length_error );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::expandFullNTENSMatrix( short_matrix ), std::length_error );
+    BOOST_CHECK_NO_THROW( tardigradeAbaqusTools::expandAbaqusNTENSVector( short_vector, 2, 1 ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( testColumnMajorView ){
+    /*!
+     * Test the non-owning column major array view
+     */
+
+    //Fake a Fortran column major array in memory with a c++ row major vector
+    std::vector< double > column_major = { 1, 4,
+                                           2, 5,
+                                           3, 6 };
+
+    //Check runtime extents
+    tardigradeAbaqusTools::ColumnMajorView< double > view( column_major.data( ), 2, 3 );
+    BOOST_TEST( view.height( ) == 2 );
+    BOOST_TEST( view.width( ) == 3 );
+    BOOST_TEST( view.size( ) == 6 );
+    BOOST_TEST( view( 0, 2 ) == 3 );
+    BOOST_TEST( view( 1, 0 ) == 4 );
+    BOOST_TEST( view[ 3 ] == 5 );
+
+    //Check writes go directly to the wrapped memory
+    view( 1, 2 ) = 60;
+    BOOST_TEST( column_major[ 5 ] == 60 );
+
+    //Check the sizes of views larger than INT_MAX entries, e.g. a chunk of 10M points by 300 state variables
+    const tardigradeAbaqusTools::ColumnMajorView< const double > large_view( nullptr, 10000000, 300 );
+    BOOST_TEST( large_view.size( ) == std::size_t( 3000000000 ) );
+    BOOST_TEST( ( tardigradeAbaqusTools::RowMajorView< const double >( nullptr, 10000000, 300 ).size( ) == std::size_t( 3000000000 ) ) );
+
+    //Check compile time extents
+    tardigradeAbaqusTools::ColumnMajorView< const double, 2, 3 > fixed_view( column_major.data( ) );
+    BOOST_TEST( fixed_view( 1, 1 ) == 5 );
+    BOOST_CHECK_THROW( ( tardigradeAbaqusTools::ColumnMajorView< double, 2, 3 >( column_major.data( ), 3, 2 ) ),
+                       std::length_error );
+
+    //Check conversion to a read-only view
+    tardigradeAbaqusTools::ColumnMajorView< const double > const_view = view;
+    BOOST_TEST( const_view( 1, 2 ) == 60 );
+}
+
+BOOST_AUTO_TEST_CASE( testRowMajorView ){
+    /*!
+     * Test the non-owning row major array view
+     */
+
+    std::vector< double > row_major = { 1, 2, 3,
+                                        4, 5, 6 };
+
+    tardigradeAbaqusTools::RowMajorView< double > view( row_major.data( ), 2, 3 );
+    BOOST_TEST( view( 0, 2 ) == 3 );
+    BOOST_TEST( view( 1, 0 ) == 4 );
+
+    view( 1, 2 ) = 60;
+    BOOST_TEST( row_major[ 5 ] == 60 );
+
+    tardigradeAbaqusTools::RowMajorView< const double, 2, 3 > fixed_view( row_major.data( ) );
+    BOOST_TEST( fixed_view( 1, 1 ) == 5 );
+}
+
+BOOST_AUTO_TEST_CASE( testColumnMajorViewConversions ){
+    /*!
+     * Test the row and column major conversion functions using array views
+     */
+
+    std::vector< double > column_major = { 1, 4,
+                                           2, 5,
+                                           3, 6 };
+    std::vector< double > row_major_answer = { 1, 2, 3,
+                                               4, 5, 6 };
+    tardigradeAbaqusTools::ColumnMajorView< double > column_view( column_major.data( ), 2, 3 );
+
+    //Column major view to vector of vectors
+    std::vector< std::vector< double > > row_major_vectors = tardigradeAbaqusTools::columnToRowMajor( column_view );
+    BOOST_TEST( tardigradeVectorTools::appendVectors( row_major_vectors ) == row_major_answer,
+                boost::test_tools::per_element() );
+
+    //Column major view to row major view
+    std::vector< double > row_major( 6, -666. );
+    tardigradeAbaqusTools::RowMajorView< double > row_view( row_major.data( ), 2, 3 );
+    tardigradeAbaqusTools::columnToRowMajor( column_view, row_view );
+    BOOST_TEST( row_major == row_major_answer, boost::test_tools::per_element() );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::columnToRowMajor( column_view, tardigradeAbaqusTools::RowMajorView< double >( row_major.data( ), 3, 2 ) ),
+                       std::length_error );
+
+    //Row major view to column major view
+    std::vector< double > result( 6, -666. );
+    tardigradeAbaqusTools::ColumnMajorView< double, 2, 3 > result_view( result.data( ) );
+    tardigradeAbaqusTools::rowToColumnMajor( result_view, row_view );
+    BOOST_TEST( result == column_major, boost::test_tools::per_element() );
+
+    //Row major vectors to column major view
+    std::fill( result.begin( ), result.end( ), -666. );
+    tardigradeAbaqusTools::rowToColumnMajor( result_view, row_major_vectors );
+    BOOST_TEST( result == column_major, boost::test_tools::per_element() );
+
+    std::fill( result.begin( ), result.end( ), -666. );
+    tardigradeAbaqusTools::rowToColumnMajor( result_view, row_major_answer );
+    BOOST_TEST( result == column_major, boost::test_tools::per_element() );
+}
+
+BOOST_AUTO_TEST_CASE( testNTENSColumnMajorView ){
+    /*!
+     * Test the NTENS vector expansion directly from a view of the Abaqus memory
+     */
+
+    std::vector< double > STRESS = { 11, 22, 33, 12 };
+    tardigradeAbaqusTools::ColumnMajorView< const double > stress_view( STRESS.data( ), 4, 1 );
+
+    std::vector< double > expected_expansion = { 11, 22, 33, 12, 0, 0 };
+    std::vector< double > vector_expansion = tardigradeAbaqusTools::expandAbaqusNTENSVector( stress_view, 3, 1 );
+    BOOST_TEST( vector_expansion == expected_expansion, boost::test_tools::per_element() );
+
+    std::vector< double > expected_tensor = { 11, 12,  0,
+                                              12, 22,  0,
+                                               0,  0, 33 };
+    std::vector< double > full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( stress_view, 3, 1 );
+    BOOST_TEST( full_tensor == expected_tensor, boost::test_tools::per_element() );
+}
+
+BOOST_AUTO_TEST_CASE( testNTENSArrayOverloads ){
+    /*!
+     * Test the fixed-size array overloads of the NTENS expansion and contraction functions
+     */
+
+    //Plane stress expansion and contraction of the Abaqus stress-type vector
+    std::array< double, 3 > abaqus_plane_stress = { 11, 22, 12 };
+    std::array< double, 6 > expected_plane_stress = { 11, 22, 0., 12, 0., 0. };
+    std::array< double, 6 > vector_expansion = tardigradeAbaqusTools::expandAbaqusNTENSVector( abaqus_plane_stress, 2, 1 );
+    BOOST_TEST( vector_expansion == expected_plane_stress, boost::test_tools::per_element() );
+
+    std::array< double, 6 > expected_contraction = { 11, 22, 12, 0., 0., 0. };
+    std::array< double, 6 > vector_contraction = tardigradeAbaqusTools::contractAbaqusNTENSVector( expected_plane_stress, 2, 1 );
+    BOOST_TEST( vector_contraction == expected_contraction, boost::test_tools::per_element() );
+
+    //Full tensor expansion and contraction
+    std::array< int, 6 > abaqus_standard = { 11, 22, 33, 12, 13, 23 };
+    std::array< int, 6 > abaqus_explicit = { 11, 22, 33, 12, 23, 13 };
+    std::array< int, 9 > expected = { 11, 12, 13,
+                                      12, 22, 23,
+                                      13, 23, 33 };
+
+    std::array< int, 9 > full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_standard, true );
+    BOOST_TEST( full_tensor == expected, boost::test_tools::per_element() );
+
+    full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_explicit, false );
+    BOOST_TEST( full_tensor == expected, boost::test_tools::per_element() );
+
+    full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_standard, 3, 3, true );
+    BOOST_TEST( full_tensor == expected, boost::test_tools::per_element() );
+
+    full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_explicit, 3, 3, false );
+    BOOST_TEST( full_tensor == expected, boost::test_tools::per_element() );
+
+    std::array< int, 6 > abaqus_vector = tardigradeAbaqusTools::contractFullNTENSTensor( expected, true );
+    BOOST_TEST( abaqus_vector == abaqus_standard, boost::test_tools::per_element() );
+
+    abaqus_vector = tardigradeAbaqusTools::contractFullNTENSTensor( expected, false );
+    BOOST_TEST( abaqus_vector == abaqus_explicit, boost::test_tools::per_element() );
+
+    abaqus_vector = tardigradeAbaqusTools::contractFullNTENSTensor( expected, 3, 3, true );
+    BOOST_TEST( abaqus_vector == abaqus_standard, boost::test_tools::per_element() );
+
+    //Axisymmetric contraction keeps the leading NTENS entries
+    std::array< int, 6 > expected_axisymmetric = { 11, 22, 33, 12, 0, 0 };
+    abaqus_vector = tardigradeAbaqusTools::contractFullNTENSTensor( expected, 3, 1 );
+    BOOST_TEST( abaqus_vector == expected_axisymmetric, boost::test_tools::per_element() );
+}
+
+BOOST_AUTO_TEST_CASE( testCompileTimeNTENS ){
+    /*!
+     * Test the compile time NDI and NSHR specializations of the NTENS vector functions
+     */
+
+    //Plane strain/axisymmetric Abaqus/Standard stress vector read directly from the Fortran pointer
+    std::vector< double > STRESS = { 11, 22, 33, 12 };
+    std::array< double, 6 > expected_expansion = { 11, 22, 33, 12, 0., 0. };
+    std::array< double, 6 > vector_expansion = tardigradeAbaqusTools::expandAbaqusNTENSVector< 3, 1 >( STRESS.data( ) );
+    BOOST_TEST( vector_expansion == expected_expansion, boost::test_tools::per_element() );
+
+    std::array< double, 4 > vector_contraction = tardigradeAbaqusTools::contractAbaqusNTENSVector< 3, 1 >( expected_expansion );
+    BOOST_TEST( std::vector< double >( vector_contraction.begin( ), vector_contraction.end( ) ) == STRESS,
+                boost::test_tools::per_element() );
+
+    //Full tensor round trip for Abaqus/Explicit plane stress
+    std::vector< double > abaqus_plane_stress = { 11, 22, 12 };
+    std::array< double, 9 > expected_tensor = { 11, 12, 0.,
+                                                12, 22, 0.,
+                                                0., 0., 0. };
+    std::array< double, 9 > full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor< 2, 1 >( abaqus_plane_stress, false );
+    BOOST_TEST( full_tensor == expected_tensor, boost::test_tools::per_element() );
+
+    std::array< double, 3 > abaqus_vector = tardigradeAbaqusTools::contractFullNTENSTensor< 2, 1 >( full_tensor, false );
+    BOOST_TEST( std::vector< double >( abaqus_vector.begin( ), abaqus_vector.end( ) ) == abaqus_plane_stress,
+                boost::test_tools::per_element() );
+
+    //Three dimensional tensor contraction for both solvers
+    std::array< int, 9 > tensor = { 11, 12, 13,
+                                    12, 22, 23,
+                                    13, 23, 33 };
+    std::array< int, 6 > abaqus_standard = { 11, 22, 33, 12, 13, 23 };
+    std::array< int, 6 > abaqus_explicit = { 11, 22, 33, 12, 23, 13 };
+    BOOST_TEST( ( tardigradeAbaqusTools::contractFullNTENSTensor< 3, 3 >( tensor, true ) ) == abaqus_standard,
+                boost::test_tools::per_element() );
+    BOOST_TEST( ( tardigradeAbaqusTools::contractFullNTENSTensor< 3, 3 >( tensor, false ) ) == abaqus_explicit,
+                boost::test_tools::per_element() );
+}
+
+BOOST_AUTO_TEST_CASE( testNTENSExpressions ){
+    /*!
+     * Test the lazy expand and contract expressions and the composite index maps
+     */
+
+    //The composite maps match the two step expansion and contraction at compile time
+    static_assert( tardigradeAbaqusTools::fullTensorNTENSMap< 3, 3, true >[ 2 ] == 4, "Abaqus/Standard 13 component" );
+    static_assert( tardigradeAbaqusTools::fullTensorNTENSMap< 3, 3, false >[ 2 ] == 5, "Abaqus/Explicit 13 component" );
+    static_assert( tardigradeAbaqusTools::fullTensorNTENSMap< 2, 1, true >[ 8 ] == -1, "Plane stress 33 component" );
+    static_assert( tardigradeAbaqusTools::NTENSFullTensorMap< 3, 1, true >[ 3 ] == 1, "Plane strain 12 component" );
+
+    //Every NDI, NSHR combination and solver type matches the two step conversions
+    for ( int NDI = 1; NDI <= 3; NDI++ ){
+        for ( int NSHR = 0; NSHR <= 3; NSHR++ ){
+            for ( bool abaqus_standard : { true, false } ){
+                std::vector< double > abaqus_vector( NDI + NSHR );
+                for ( int index = 0; index < NDI + NSHR; index++ ){
+                    abaqus_vector[ index ] = index + 1;
+                }
+
+                std::vector< double > expected_tensor = tardigradeAbaqusTools::expandFullNTENSTensor(
+                    tardigradeAbaqusTools::expandAbaqusNTENSVector( abaqus_vector, NDI, NSHR ), abaqus_standard );
+                std::vector< double > full_tensor = tardigradeAbaqusTools::lazyExpandFullNTENSTensor( abaqus_vector, NDI, NSHR,
+                                                                                                      abaqus_standard );
+                BOOST_TEST( full_tensor == expected_tensor, boost::test_tools::per_element() );
+                BOOST_TEST( tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_vector, NDI, NSHR, abaqus_standard ) == expected_tensor,
+                            boost::test_tools::per_element() );
+
+                std::vector< double > expected_vector = tardigradeAbaqusTools::contractAbaqusNTENSVector(
+                    tardigradeAbaqusTools::contractFullNTENSTensor( expected_tensor, abaqus_standard ), NDI, NSHR );
+                BOOST_TEST( expected_vector == abaqus_vector, boost::test_tools::per_element() );
+                BOOST_TEST( tardigradeAbaqusTools::contractFullNTENSTensor( expected_tensor, NDI, NSHR, abaqus_standard ) == abaqus_vector,
+                            boost::test_tools::per_element() );
+
+                //Chained expressions round trip without intermediate storage
+                std::vector< double > round_trip = tardigradeAbaqusTools::lazyContractFullNTENSTensor(
+                    tardigradeAbaqusTools::lazyExpandFullNTENSTensor( abaqus_vector.data( ), NDI, NSHR, abaqus_standard ),
+                    NDI, NSHR, abaqus_standard );
+                BOOST_TEST( round_trip == abaqus_vector, boost::test_tools::per_element() );
+            }
+        }
+    }
+
+    //Compile time expressions read from the Fortran pointer and write through a view
+    std::vector< double > STRESS = { 11, 22, 33, 12 };
+    auto full_tensor = tardigradeAbaqusTools::lazyExpandFullNTENSTensor< 3, 1 >( STRESS.data( ) );
+    BOOST_TEST( full_tensor.size( ) == 9 );
+    BOOST_TEST( full_tensor( 0, 1 ) == 12 );
+    BOOST_TEST( full_tensor( 2, 2 ) == 33 );
+    BOOST_TEST( full_tensor( 1, 2 ) == 0. );
+
+    std::vector< double > STRESS_NEW( 4 );
+    tardigradeAbaqusTools::ColumnMajorView< double, 4, 1 > stress_new( STRESS_NEW.data( ) );
+    auto abaqus_vector = tardigradeAbaqusTools::lazyContractFullNTENSTensor< 3, 1 >( full_tensor );
+    BOOST_TEST( abaqus_vector.size( ) == 4 );
+    abaqus_vector.evaluate( stress_new );
+    BOOST_TEST( STRESS_NEW == STRESS, boost::test_tools::per_element() );
+
+    std::array< double, 6 > padded_vector = abaqus_vector;
+    std::array< double, 6 > expected_padded = { 11, 22, 33, 12, 0., 0. };
+    BOOST_TEST( padded_vector == expected_padded, boost::test_tools::per_element() );
+}
+
+BOOST_AUTO_TEST_CASE( testDispatchNTENS ){
+    /*!
+     * Test the runtime to compile time NDI and NSHR dispatcher
+     */
+
+    std::vector< double > STRESS = { 11, 22, 33, 12 };
+    std::vector< double > expected = { 11, 12, 0.,
+                                       12, 22, 0.,
+                                       0., 0., 33 };
+
+    std::array< double, 9 > full_tensor = tardigradeAbaqusTools::dispatchNTENS( 3, 1, [ & ]( auto ndi, auto nshr ){
+        return tardigradeAbaqusTools::expandFullNTENSTensor< decltype( ndi )::value, decltype( nshr )::value >( STRESS );
+    } );
+    BOOST_TEST( std::vector< double >( full_tensor.begin( ), full_tensor.end( ) ) == expected,
+                boost::test_tools::per_element() );
+
+    int ntens = tardigradeAbaqusTools::dispatchNTENS( 2, 1, [ ]( auto ndi, auto nshr ){
+        return decltype( ndi )::value + decltype( nshr )::value;
+    } );
+    BOOST_TEST( ntens == 3 );
+
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::dispatchNTENS( 1, 0, [ ]( auto, auto ){ return 0; } ),
+                       std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_CASE( testAbaqusSolver ){
+    /*!
+     * Test the compile time solver type overloads against the runtime ``abaqus_standard`` overloads
+     */
+
+    using tardigradeAbaqusTools::AbaqusSolver;
+
+    static_assert( tardigradeAbaqusTools::expandOrder( AbaqusSolver::Explicit )[ 2 ] == 5, "Abaqus/Explicit 13 component" );
+    static_assert( tardigradeAbaqusTools::contractOrder( AbaqusSolver::Standard )[ 4 ] == 2, "Abaqus/Standard 13 component" );
+    static_assert( tardigradeAbaqusTools::abaqusSolver( false ) == AbaqusSolver::Explicit, "Explicit solver flag" );
+    static_assert( tardigradeAbaqusTools::isPackingRoundTrip( AbaqusSolver::Standard ), "Abaqus/Standard round trip" );
+    static_assert( tardigradeAbaqusTools::isNTENSRoundTrip( ), "NTENS round trip" );
+
+    std::array< double, 6 > long_vector = { 11, 22, 33, 12, 13, 23 };
+    std::array< double, 9 > tensor = { 11, 12, 13,
+                                       12, 22, 23,
+                                       13, 23, 33 };
+    std::array< double, 81 > full_matrix;
+    for ( unsigned int index = 0; index < 81; index++ ){
+        full_matrix[ index ] = index + 1;
+    }
+
+    tardigradeAbaqusTools::dispatchSolver( true, [ & ]( auto solver ){
+        BOOST_TEST( ( decltype( solver )::value == AbaqusSolver::Standard ) );
+    } );
+
+    for ( bool abaqus_standard : { true, false } ){
+        tardigradeAbaqusTools::dispatchSolver( abaqus_standard, [ & ]( auto solver ){
+            constexpr AbaqusSolver SOLVER = decltype( solver )::value;
+
+            std::array< double, 9 > full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor< SOLVER >( long_vector );
+            BOOST_TEST( full_tensor == tardigradeAbaqusTools::expandFullNTENSTensor( long_vector, 3, 3, abaqus_standard ),
+                        boost::test_tools::per_element() );
+
+            std::array< double, 6 > contracted = tardigradeAbaqusTools::contractFullNTENSTensor< SOLVER >( tensor );
+            BOOST_TEST( contracted == tardigradeAbaqusTools::contractFullNTENSTensor( tensor, abaqus_standard ),
+                        boost::test_tools::per_element() );
+
+            std::array< double, 4 > STRESS = { 11, 22, 33, 12 };
+            std::array< double, 9 > plane_strain = tardigradeAbaqusTools::expandFullNTENSTensor< 3, 1, SOLVER >( STRESS );
+            BOOST_TEST( plane_strain == ( tardigradeAbaqusTools::expandFullNTENSTensor< 3, 1 >( STRESS, abaqus_standard ) ),
+                        boost::test_tools::per_element() );
+            BOOST_TEST( ( tardigradeAbaqusTools::contractFullNTENSTensor< 3, 1, SOLVER >( plane_strain ) ) == STRESS,
+                        boost::test_tools::per_element() );
+
+            std::array< double, 36 > full_abaqus_matrix = tardigradeAbaqusTools::contractFullNTENSMatrix< SOLVER >( full_matrix );
+            BOOST_TEST( full_abaqus_matrix == tardigradeAbaqusTools::contractFullNTENSMatrix( full_matrix, abaqus_standard ),
+                        boost::test_tools::per_element() );
+            BOOST_TEST( tardigradeAbaqusTools::expandFullNTENSMatrix< SOLVER >( full_abaqus_matrix ) ==
+                        tardigradeAbaqusTools::expandFullNTENSMatrix( full_abaqus_matrix, abaqus_standard ),
+                        boost::test_tools::per_element() );
+
+            std::array< double, 16 > DDSDDE, expected_DDSDDE;
+            tardigradeAbaqusTools::contractFullNTENSMatrix< 3, 1, SOLVER >( DDSDDE.data( ), full_matrix.data( ) );
+            tardigradeAbaqusTools::contractFullNTENSMatrix( expected_DDSDDE.data( ), full_matrix.data( ), 3, 1, abaqus_standard );
+            BOOST_TEST( DDSDDE == expected_DDSDDE, boost::test_tools::per_element() );
+
+            std::array< double, 81 > expanded, expected_expanded;
+            tardigradeAbaqusTools::expandFullNTENSMatrix< 3, 1, SOLVER >( expanded.data( ), DDSDDE.data( ) );
+            tardigradeAbaqusTools::expandFullNTENSMatrix( expected_expanded.data( ), DDSDDE.data( ), 3, 1, abaqus_standard );
+            BOOST_TEST( expanded == expected_expanded, boost::test_tools::per_element() );
+        } );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testContractFlatNTENSMatrix ){
+    /*!
+     * Test contraction of flat 9x9 and 6x6 matrices directly into column major NTENSxNTENS arrays
+     */
+
+    //Flat row-major 9x9 matrix where the entry value encodes the ijkl indices
+    std::array< int, 81 > full_matrix;
+    for ( int i = 0; i < 3; i++ ){
+        for ( int j = 0; j < 3; j++ ){
+            for ( int k = 0; k < 3; k++ ){
+                for ( int l = 0; l < 3; l++ ){
+                    full_matrix[ 9 * ( 3 * i + j ) + 3 * k + l ] = 1000 * ( i + 1 ) + 100 * ( j + 1 ) + 10 * ( k + 1 ) + l + 1;
+                }
+            }
+        }
+    }
+
+    std::array< int, 36 > full_abaqus_standard_matrix = { 1111, 1122, 1133, 1112, 1113, 1123,
+                                                          2211, 2222, 2233, 2212, 2213, 2223,
+                                                          3311, 3322, 3333, 3312, 3313, 3323,
+                                                          1211, 1222, 1233, 1212, 1213, 1223,
+                                                          1311, 1322, 1333, 1312, 1313, 1323,
+                                                          2311, 2322, 2333, 2312, 2313, 2323 };
+    std::array< int, 36 > flat_result = tardigradeAbaqusTools::contractFullNTENSMatrix( full_matrix );
+    BOOST_TEST( flat_result == full_abaqus_standard_matrix, boost::test_tools::per_element() );
+
+    //Three dimensional DDSDDE is the transpose of the row-major 6x6 matrix
+    std::vector< int > DDSDDE( 36, -666 );
+    std::vector< int > expected_full( 36 );
+    for ( int row = 0; row < 6; row++ ){
+        for ( int col = 0; col < 6; col++ ){
+            expected_full[ 6 * col + row ] = full_abaqus_standard_matrix[ 6 * row + col ];
+        }
+    }
+    tardigradeAbaqusTools::contractFullNTENSMatrix( DDSDDE.data( ), full_matrix, 3, 3 );
+    BOOST_TEST( DDSDDE == expected_full, boost::test_tools::per_element() );
+
+    std::fill( DDSDDE.begin( ), DDSDDE.end( ), -666 );
+    tardigradeAbaqusTools::contractAbaqusNTENSMatrix( DDSDDE.data( ), full_abaqus_standard_matrix, 3, 3 );
+    BOOST_TEST( DDSDDE == expected_full, boost::test_tools::per_element() );
+
+    //Plane stress DDSDDE
+    std::vector< int > DDSDDE_plane_stress( 9, -666 );
+    std::vector< int > expected_plane_stress = { 1111, 2211, 1211,
+                                                 1122, 2222, 1222,
+                                                 1112, 2212, 1212 };
+    tardigradeAbaqusTools::contractFullNTENSMatrix( DDSDDE_plane_stress.data( ), full_matrix.data( ), 2, 1 );
+    BOOST_TEST( DDSDDE_plane_stress == expected_plane_stress, boost::test_tools::per_element() );
+
+    std::fill( DDSDDE_plane_stress.begin( ), DDSDDE_plane_stress.end( ), -666 );
+    tardigradeAbaqusTools::contractAbaqusNTENSMatrix( DDSDDE_plane_stress.data( ), full_abaqus_standard_matrix, 2, 1 );
+    BOOST_TEST( DDSDDE_plane_stress == expected_plane_stress, boost::test_tools::per_element() );
+}
+
+BOOST_AUTO_TEST_CASE( testExpandNTENSMatrix ){
+    /*!
+     * Test expansion of Abaqus NTENS matrices to full 9x9 matrices and the symmetric flat conversions
+     */
+
+    //Major symmetric 6x6 matrix where the entry value encodes the Voigt indices
+    std::vector< std::vector< double > > full_abaqus_matrix( 6, std::vector< double >( 6 ) );
+    for ( unsigned int row = 0; row < 6; row++ ){
+        for ( unsigned int col = 0; col < 6; col++ ){
+            full_abaqus_matrix[ row ][ col ] = 10 * ( std::min( row, col ) + 1 ) + std::max( row, col ) + 1;
+        }
+    }
+
+    for ( bool abaqus_standard : { true, false } ){
+        std::vector< std::vector< double > > full_matrix = tardigradeAbaqusTools::expandFullNTENSMatrix( full_abaqus_matrix,
+                                                                                                         abaqus_standard );
+        BOOST_TEST( full_matrix.size( ) == 9 );
+
+        //D_{1113} and D_{3111} are the 11-13 entry of the 6x6 matrix for both solver orderings
+        BOOST_TEST( full_matrix[ 0 ][ 2 ] == ( abaqus_standard ? 15 : 16 ) );
+        BOOST_TEST( full_matrix[ 0 ][ 6 ] == full_matrix[ 0 ][ 2 ] );
+        BOOST_TEST( full_matrix[ 6 ][ 0 ] == full_matrix[ 0 ][ 2 ] );
+
+        std::vector< std::vector< double > > round_trip = tardigradeAbaqusTools::contractFullNTENSMatrix( full_matrix,
+                                                                                                          abaqus_standard );
+        BOOST_TEST( tardigradeVectorTools::appendVectors( round_trip ) ==
+                    tardigradeVectorTools::appendVectors( full_abaqus_matrix ), boost::test_tools::per_element() );
+
+        std::vector< double > flat_abaqus = tardigradeVectorTools::appendVectors( full_abaqus_matrix );
+        std::array< double, 36 > full_abaqus_array;
+        std::copy( flat_abaqus.begin( ), flat_abaqus.end( ), full_abaqus_array.begin( ) );
+        std::array< double, 81 > full_array = tardigradeAbaqusTools::expandFullNTENSMatrix( full_abaqus_array, abaqus_standard );
+        std::vector< double > flat_full = tardigradeVectorTools::appendVectors( full_matrix );
+        BOOST_TEST( std::vector< double >( full_array.begin( ), full_array.end( ) ) == flat_full,
+                    boost::test_tools::per_element() );
+        std::array< double, 36 > array_round_trip = tardigradeAbaqusTools::contractFullNTENSMatrix( full_array, abaqus_standard );
+        BOOST_TEST( array_round_trip == full_abaqus_array, boost::test_tools::per_element() );
+
+        for ( const auto &[ NDI, NSHR ] : std::vector< std::pair< int, int > >{ { 3, 3 }, { 3, 1 }, { 2, 1 } } ){
+            const int NTENS = NDI + NSHR;
+
+            //The NTENS expansion is the inverse of the NTENS contraction
+            std::vector< std::vector< double > > abaqus_matrix = tardigradeAbaqusTools::contractAbaqusNTENSMatrix(
+                full_abaqus_matrix, NDI, NSHR );
+            std::vector< std::vector< double > > expanded = tardigradeAbaqusTools::expandAbaqusNTENSMatrix( abaqus_matrix, NDI, NSHR );
+            BOOST_TEST( tardigradeAbaqusTools::contractAbaqusNTENSMatrix( expanded, NDI, NSHR ) == abaqus_matrix );
+
+            std::vector< std::vector< double > > expected_full = tardigradeAbaqusTools::expandFullNTENSMatrix( expanded,
+                                                                                                               abaqus_standard );
+            std::vector< std::vector< double > > answer = tardigradeAbaqusTools::expandFullNTENSMatrix( abaqus_matrix, NDI, NSHR,
+                                                                                                        abaqus_standard );
+            BOOST_TEST( tardigradeVectorTools::appendVectors( answer ) == tardigradeVectorTools::appendVectors( expected_full ),
+                        boost::test_tools::per_element() );
+            BOOST_TEST( tardigradeAbaqusTools::contractFullNTENSMatrix( answer, NDI, NSHR, abaqus_standard ) == abaqus_matrix );
+
+            //Column major DDSDDE with the lower triangle overwritten to check that the symmetric mode only reads the
+            //upper triangle
+            std::vector< double > DDSDDE( NTENS * NTENS );
+            std::vector< double > DDSDDE_upper( NTENS * NTENS );
+            for ( int col = 0; col < NTENS; col++ ){
+                for ( int row = 0; row < NTENS; row++ ){
+                    DDSDDE[ col * NTENS + row ] = abaqus_matrix[ row ][ col ];
+                    DDSDDE_upper[ col * NTENS + row ] = row <= col ? abaqus_matrix[ row ][ col ] : -666;
+                }
+            }
+
+            std::vector< double > flat_answer( 81, -666 );
+            tardigradeAbaqusTools::expandFullNTENSMatrix( flat_answer.data( ), DDSDDE.data( ), NDI, NSHR, abaqus_standard );
+            std::vector< double > flat_expected = tardigradeVectorTools::appendVectors( expected_full );
+            BOOST_TEST( flat_answer == flat_expected, boost::test_tools::per_element() );
+
+            std::fill( flat_answer.begin( ), flat_answer.end( ), -666 );
+            tardigradeAbaqusTools::expandFullNTENSMatrix( flat_answer.data( ), DDSDDE_upper.data( ), NDI, NSHR, abaqus_standard,
+                                                          true );
+            BOOST_TEST( flat_answer == flat_expected, boost::test_tools::per_element() );
+
+            //Full matrix with the entries below the NTENS diagonal overwritten for the symmetric contraction
+            std::array< unsigned int, 6 > fullIndex = tardigradeAbaqusTools::NTENSFullTensorIndex( NDI, NSHR, abaqus_standard );
+            std::vector< double > full_upper = flat_expected;
+            for ( int row = 0; row < NTENS; row++ ){
+                for ( int col = 0; col < row; col++ ){
+                    full_upper[ 9 * fullIndex[ row ] + fullIndex[ col ] ] = -666;
+                }
+            }
+
+            std::vector< double > DDSDDE_answer( NTENS * NTENS, -666 );
+            tardigradeAbaqusTools::contractFullNTENSMatrix( DDSDDE_answer.data( ), flat_expected.data( ), NDI, NSHR,
+                                                            abaqus_standard );
+            BOOST_TEST( DDSDDE_answer == DDSDDE, boost::test_tools::per_element() );
+
+            std::fill( DDSDDE_answer.begin( ), DDSDDE_answer.end( ), -666 );
+            tardigradeAbaqusTools::contractFullNTENSMatrix( DDSDDE_answer.data( ), full_upper.data( ), NDI, NSHR,
+                                                            abaqus_standard, true );
+            BOOST_TEST( DDSDDE_answer == DDSDDE, boost::test_tools::per_element() );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testFullNTENSTensorBlock ){
+    /*!
+     * Test expansion and contraction of VUMAT style blocks of stress-type vectors
+     */
+
+    //Fake a Fortran nblock x ( ndir + nshr ) Abaqus/Explicit block with two material points
+    const int nblock = 2;
+    std::vector< double > stressOld = {  11,  111,
+                                         22,  122,
+                                         33,  133,
+                                         12,  112,
+                                         23,  123,
+                                         13,  113 };
+    std::vector< double > expected = {  11,  111,
+                                        12,  112,
+                                        13,  113,
+                                        12,  112,
+                                        22,  122,
+                                        23,  123,
+                                        13,  113,
+                                        23,  123,
+                                        33,  133 };
+
+    std::vector< double > full_block( 9 * nblock, -666. );
+    tardigradeAbaqusTools::expandFullNTENSTensorBlock( full_block.data( ), stressOld.data( ), nblock, 3, 3, false );
+    BOOST_TEST( full_block == expected, boost::test_tools::per_element() );
+
+    std::vector< double > stressNew( 6 * nblock, -666. );
+    tardigradeAbaqusTools::contractFullNTENSTensorBlock( stressNew.data( ), full_block.data( ), nblock, 3, 3, false );
+    BOOST_TEST( stressNew == stressOld, boost::test_tools::per_element() );
+
+    //Abaqus/Standard ordering of a plane strain block matches the single point functions
+    std::vector< double > block_plane_strain = { 11, 111,
+                                                 22, 122,
+                                                 33, 133,
+                                                 12, 112 };
+    tardigradeAbaqusTools::expandFullNTENSTensorBlock( full_block.data( ), block_plane_strain.data( ), nblock, 3, 1, true );
+    for ( int k = 0; k < nblock; k++ ){
+        std::vector< double > point = { block_plane_strain[ k ], block_plane_strain[ nblock + k ],
+                                        block_plane_strain[ 2 * nblock + k ], block_plane_strain[ 3 * nblock + k ] };
+        std::vector< double > full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( point, 3, 1, true );
+        for ( int component = 0; component < 9; component++ ){
+            BOOST_TEST( full_block[ component * nblock + k ] == full_tensor[ component ] );
+        }
+    }
+
+    std::vector< double > result_plane_strain( 4 * nblock, -666. );
+    tardigradeAbaqusTools::contractFullNTENSTensorBlock( result_plane_strain.data( ), full_block.data( ), nblock, 3, 1, true );
+    BOOST_TEST( result_plane_strain == block_plane_strain, boost::test_tools::per_element() );
+}
+
+BOOST_AUTO_TEST_CASE( testFullNTENSTensorBatch ){
+    /*!
+     * Test the batched full tensor expansion and contraction kernels. Every instruction set supported by the CPU must
+     * be bitwise identical to the scalar path.
+     */
+
+    const int npoints = 37;
+    std::vector< double > long_vectors( 6 * npoints );
+    for ( unsigned int index = 0; index < long_vectors.size( ); index++ ){
+        long_vectors[ index ] = ( index % 2 == 0 ? -1. : 1. ) * ( index + 0.1 ) / 3.;
+    }
+
+    //Instruction sets not supported by the CPU fall back to the supported ones
+    const std::vector< tardigradeAbaqusTools::SIMDLevel > simd_levels = { tardigradeAbaqusTools::SIMDLevel::Scalar,
+                                                                          tardigradeAbaqusTools::SIMDLevel::AVX2,
+                                                                          tardigradeAbaqusTools::SIMDLevel::AVX512 };
+    BOOST_TEST( ( tardigradeAbaqusTools::supportedSIMDLevel( tardigradeAbaqusTools::SIMDLevel::AVX512 ) ==
+                  tardigradeAbaqusTools::detectSIMDLevel( ) ) );
+    BOOST_TEST( ( tardigradeAbaqusTools::supportedSIMDLevel( tardigradeAbaqusTools::SIMDLevel::Scalar ) ==
+                  tardigradeAbaqusTools::SIMDLevel::Scalar ) );
+
+    for ( bool abaqus_standard : { true, false } ){
+
+        //Scalar reference from the single point functions
+        std::vector< double > expected_full( 9 * npoints );
+        for ( int point = 0; point < npoints; point++ ){
+            std::vector< double > long_vector( long_vectors.begin( ) + 6 * point, long_vectors.begin( ) + 6 * ( point + 1 ) );
+            std::vector< double > full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( long_vector, abaqus_standard );
+            std::copy( full_tensor.begin( ), full_tensor.end( ), expected_full.begin( ) + 9 * point );
+        }
+
+        for ( auto simd_level : simd_levels ){
+            std::vector< double > full_tensors( 9 * npoints, -666. );
+            tardigradeAbaqusTools::expandFullNTENSTensorBatch( full_tensors.data( ), long_vectors.data( ), npoints,
+                                                               abaqus_standard, simd_level );
+            BOOST_TEST( std::memcmp( full_tensors.data( ), expected_full.data( ), sizeof( double ) * full_tensors.size( ) ) == 0 );
+
+            std::vector< double > result( 6 * npoints, -666. );
+            tardigradeAbaqusTools::contractFullNTENSTensorBatch( result.data( ), full_tensors.data( ), npoints,
+                                                                 abaqus_standard, simd_level );
+            BOOST_TEST( std::memcmp( result.data( ), long_vectors.data( ), sizeof( double ) * result.size( ) ) == 0 );
+        }
+    }
+
+    //Non-double batches use the scalar path
+    std::vector< int > int_vectors = { 11, 22, 33, 12, 13, 23 };
+    std::vector< int > int_expected = { 11, 12, 13,
+                                        12, 22, 23,
+                                        13, 23, 33 };
+    std::vector< int > int_full( 9 );
+    tardigradeAbaqusTools::expandFullNTENSTensorBatch( int_full.data( ), int_vectors.data( ), 1 );
+    BOOST_TEST( int_full == int_expected, boost::test_tools::per_element() );
+}
+
+BOOST_AUTO_TEST_CASE( testMixedPrecision ){
+    /*!
+     * Test the conversions between single precision storage and double precision tensors. Every instruction set
+     * supported by the CPU must be bitwise identical to the scalar path.
+     */
+
+    //Instruction sets not supported by the CPU fall back to the supported ones
+    const std::vector< tardigradeAbaqusTools::SIMDLevel > simd_levels = { tardigradeAbaqusTools::SIMDLevel::Scalar,
+                                                                          tardigradeAbaqusTools::SIMDLevel::AVX2,
+                                                                          tardigradeAbaqusTools::SIMDLevel::AVX512 };
+
+    //Widen and narrow a STATEV style array with a remainder for every vector width
+    const int size = 37;
+    std::vector< double > values( size );
+    std::vector< float > narrowed( size );
+    for ( int index = 0; index < size; index++ ){
+        values[ index ] = ( index % 2 == 0 ? -1. : 1. ) * ( index + 0.1 ) / 3.;
+        narrowed[ index ] = static_cast< float >( values[ index ] );
+    }
+    for ( auto simd_level : simd_levels ){
+        std::vector< float > single( size, -666.f );
+        tardigradeAbaqusTools::convertPrecision( single.data( ), values.data( ), size, simd_level );
+        BOOST_TEST( std::memcmp( single.data( ), narrowed.data( ), sizeof( float ) * size ) == 0 );
+
+        std::vector< double > widened( size, -666. );
+        tardigradeAbaqusTools::convertPrecision( widened.data( ), single.data( ), size, simd_level );
+        for ( int index = 0; index < size; index++ ){
+            BOOST_TEST( widened[ index ] == static_cast< double >( narrowed[ index ] ) );
+        }
+    }
+
+    //Single precision batches widen to double precision tensors and narrow back
+    const int npoints = 13;
+    std::vector< float > long_vectors( 6 * npoints );
+    for ( unsigned int index = 0; index < long_vectors.size( ); index++ ){
+        long_vectors[ index ] = ( index % 2 == 0 ? -1.f : 1.f ) * ( index + 0.1f ) / 3.f;
+    }
+    for ( bool abaqus_standard : { true, false } ){
+        std::vector< double > expected_full( 9 * npoints );
+        for ( int point = 0; point < npoints; point++ ){
+            std::vector< double > long_vector( long_vectors.begin( ) + 6 * point, long_vectors.begin( ) + 6 * ( point + 1 ) );
+            std::vector< double > full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( long_vector, abaqus_standard );
+            std::copy( full_tensor.begin( ), full_tensor.end( ), expected_full.begin( ) + 9 * point );
+        }
+
+        for ( auto simd_level : simd_levels ){
+            std::vector< double > full_tensors( 9 * npoints, -666. );
+            tardigradeAbaqusTools::expandFullNTENSTensorBatch( full_tensors.data( ), long_vectors.data( ), npoints,
+                                                               abaqus_standard, simd_level );
+            BOOST_TEST( std::memcmp( full_tensors.data( ), expected_full.data( ), sizeof( double ) * full_tensors.size( ) ) == 0 );
+
+            std::vector< float > result( 6 * npoints, -666.f );
+            tardigradeAbaqusTools::contractFullNTENSTensorBatch( result.data( ), full_tensors.data( ), npoints,
+                                                                 abaqus_standard, simd_level );
+            BOOST_TEST( std::memcmp( result.data( ), long_vectors.data( ), sizeof( float ) * result.size( ) ) == 0 );
+        }
+    }
+
+    //Single precision VUMAT blocks
+    const int nblock = 5;
+    std::vector< float > stress_old( 6 * nblock );
+    for ( unsigned int index = 0; index < stress_old.size( ); index++ ){
+        stress_old[ index ] = ( index + 1.f ) / 7.f;
+    }
+    std::vector< double > full_block( 9 * nblock, -666. );
+    tardigradeAbaqusTools::expandFullNTENSTensorBlock( full_block.data( ), stress_old.data( ), nblock, 3, 3, false );
+    BOOST_TEST( full_block[ 0 ] == static_cast< double >( stress_old[ 0 ] ) );
+    BOOST_TEST( full_block[ 1 * nblock + 2 ] == static_cast< double >( stress_old[ 3 * nblock + 2 ] ) );
+    std::vector< float > stress_new( 6 * nblock, -666.f );
+    tardigradeAbaqusTools::contractFullNTENSTensorBlock( stress_new.data( ), full_block.data( ), nblock, 3, 3, false );
+    BOOST_TEST( stress_new == stress_old, boost::test_tools::per_element() );
+
+    //Single precision DDSDDE
+    const int NDI = 3;
+    const int NSHR = 1;
+    const int NTENS = NDI + NSHR;
+    std::vector< float > DDSDDE( NTENS * NTENS );
+    for ( int index = 0; index < NTENS * NTENS; index++ ){
+        DDSDDE[ index ] = ( index + 1.f ) / 3.f;
+    }
+    std::array< double, 81 > full_matrix;
+    tardigradeAbaqusTools::expandFullNTENSMatrix( full_matrix.data( ), DDSDDE.data( ), NDI, NSHR );
+    std::vector< double > double_DDSDDE( DDSDDE.begin( ), DDSDDE.end( ) );
+    std::array< double, 81 > expected_matrix;
+    tardigradeAbaqusTools::expandFullNTENSMatrix( expected_matrix.data( ), double_DDSDDE.data( ), NDI, NSHR );
+    BOOST_TEST( full_matrix == expected_matrix, boost::test_tools::per_element() );
+    std::vector< float > result_DDSDDE( NTENS * NTENS, -666.f );
+    tardigradeAbaqusTools::contractFullNTENSMatrix( result_DDSDDE.data( ), full_matrix, NDI, NSHR );
+    BOOST_TEST( result_DDSDDE == DDSDDE, boost::test_tools::per_element() );
+
+    //Double precision results written to single precision Fortran arrays
+    std::vector< std::vector< double > > row_major = { { 1. / 3., 2. / 3. },
+                                                       { 4. / 3., 5. / 3. },
+                                                       { 7. / 3., 8. / 3. } };
+    std::vector< float > expected_column_major = { 1.f / 3.f, 4.f / 3.f, 7.f / 3.f, 2.f / 3.f, 5.f / 3.f, 8.f / 3.f };
+    std::vector< float > column_major( 6, -666.f );
+    tardigradeAbaqusTools::rowToColumnMajor( column_major.data( ), row_major, 3, 2 );
+    BOOST_TEST( column_major == expected_column_major, boost::test_tools::per_element() );
+    std::vector< double > flat_row_major = { 1. / 3., 2. / 3., 4. / 3., 5. / 3., 7. / 3., 8. / 3. };
+    std::fill( column_major.begin( ), column_major.end( ), -666.f );
+    tardigradeAbaqusTools::rowToColumnMajor( column_major.data( ), flat_row_major, 3, 2 );
+    BOOST_TEST( column_major == expected_column_major, boost::test_tools::per_element() );
+}
+
+BOOST_AUTO_TEST_CASE( testBatchConverter ){
+    /*!
+     * Test the element batch converter against the single point conversions
+     */
+
+    const int npoints = 27;
+    //Element types without a compile time specialization, e.g. ( 3, 0 ) and ( 1, 0 ), use the runtime loops
+    for ( auto ntens : { std::make_pair( 3, 3 ), std::make_pair( 3, 1 ), std::make_pair( 2, 1 ), std::make_pair( 3, 0 ),
+                         std::make_pair( 1, 0 ) } ){
+        for ( bool abaqus_standard : { true, false } ){
+            const int NDI = ntens.first;
+            const int NSHR = ntens.second;
+            const int NTENS = NDI + NSHR;
+            tardigradeAbaqusTools::BatchConverter< double > converter( NDI, NSHR, abaqus_standard );
+            BOOST_TEST( converter.NTENS( ) == NTENS );
+            BOOST_TEST( converter.abaqusStandard( ) == abaqus_standard );
+
+            std::vector< double > STRESS( NTENS * npoints );
+            for ( unsigned int index = 0; index < STRESS.size( ); index++ ){
+                STRESS[ index ] = index + 1;
+            }
+            std::vector< double > DDSDDE( NTENS * NTENS * npoints );
+            for ( unsigned int index = 0; index < DDSDDE.size( ); index++ ){
+                DDSDDE[ index ] = 0.5 * index;
+            }
+
+            std::vector< double > full_tensors( 9 * npoints, -666. );
+            converter.expandTensors( full_tensors.data( ), STRESS.data( ), npoints );
+            std::vector< double > full_tangents( 81 * npoints, -666. );
+            converter.expandTangents( full_tangents.data( ), DDSDDE.data( ), npoints );
+            for ( int point = 0; point < npoints; point++ ){
+                std::vector< double > abaqus_vector( STRESS.begin( ) + NTENS * point, STRESS.begin( ) + NTENS * ( point + 1 ) );
+                std::vector< double > expected = tardigradeAbaqusTools::expandFullNTENSTensor( abaqus_vector, NDI, NSHR, abaqus_standard );
+                BOOST_TEST( std::vector< double >( full_tensors.begin( ) + 9 * point, full_tensors.begin( ) + 9 * ( point + 1 ) ) == expected,
+                            boost::test_tools::per_element() );
+
+                std::array< double, 81 > expected_tangent;
+                tardigradeAbaqusTools::expandFullNTENSMatrix( expected_tangent.data( ), DDSDDE.data( ) + NTENS * NTENS * point,
+                                                              NDI, NSHR, abaqus_standard );
+                BOOST_TEST( std::memcmp( full_tangents.data( ) + 81 * point, expected_tangent.data( ), sizeof( double ) * 81 ) == 0 );
+            }
+
+            //Single precision storage round trips through the double precision tensors
+            std::vector< float > single_stress( NTENS * npoints, -666.f );
+            converter.contractTensors( single_stress.data( ), full_tensors.data( ), npoints );
+            BOOST_TEST( std::vector< double >( single_stress.begin( ), single_stress.end( ) ) == STRESS,
+                        boost::test_tools::per_element() );
+            std::vector< double > result_tangents( DDSDDE.size( ), -666. );
+            converter.contractTangents( result_tangents.data( ), full_tangents.data( ), npoints );
+            BOOST_TEST( result_tangents == DDSDDE, boost::test_tools::per_element() );
+
+            //Arena backed outputs
+            tardigradeAbaqusTools::BumpArena arena( 1 << 16 );
+            auto arena_tensors = converter.expandTensors( STRESS.data( ), npoints, arena );
+            BOOST_TEST( arena_tensors.height( ) == npoints );
+            BOOST_TEST( std::equal( full_tensors.begin( ), full_tensors.end( ), arena_tensors.data( ) ) );
+            auto arena_tangents = converter.expandTangents( DDSDDE.data( ), npoints, arena );
+            BOOST_TEST( std::equal( full_tangents.begin( ), full_tangents.end( ), arena_tangents.data( ) ) );
+            BOOST_TEST( arena.heapAllocations( ) == 0 );
+        }
+    }
+
+    //Chunked updates across several chunks
+    const int NDI = 3;
+    const int NSHR = 1;
+    tardigradeAbaqusTools::BatchConverter< double > converter( NDI, NSHR );
+    const int many_points = 2 * tardigradeAbaqusTools::BatchConverter< double >::tensorChunkPoints + 3;
+    std::vector< double > STRESS( 4 * many_points );
+    for ( unsigned int index = 0; index < STRESS.size( ); index++ ){
+        STRESS[ index ] = index + 1;
+    }
+    std::vector< double > expected_stress( STRESS );
+    for ( auto &value : expected_stress ){
+        value *= 2;
+    }
+    int chunks = 0;
+    int points = 0;
+    converter.update( STRESS.data( ), many_points, [ & ]( tardigradeAbaqusTools::RowMajorView< double, -1, 9 > full_tensors,
+                                                         int first_point ){
+        BOOST_TEST( first_point == points );
+        for ( std::size_t index = 0; index < full_tensors.size( ); index++ ){
+            full_tensors[ index ] *= 2;
+        }
+        points += full_tensors.height( );
+        chunks++;
+    } );
+    BOOST_TEST( chunks == 3 );
+    BOOST_TEST( points == many_points );
+    BOOST_TEST( STRESS == expected_stress, boost::test_tools::per_element() );
+
+    //Stress and tangent updates
+    const int tangent_points = tardigradeAbaqusTools::BatchConverter< double >::tangentChunkPoints + 1;
+    std::vector< float > single_stress( 4 * tangent_points, 1.f );
+    std::vector< float > DDSDDE( 16 * tangent_points, -666.f );
+    converter.update( single_stress.data( ), DDSDDE.data( ), tangent_points,
+                      [ & ]( tardigradeAbaqusTools::RowMajorView< double, -1, 9 > full_tensors,
+                             tardigradeAbaqusTools::RowMajorView< double, -1, 81 > full_tangents, int ){
+        for ( int point = 0; point < full_tensors.height( ); point++ ){
+            BOOST_TEST( full_tangents( point, 0 ) == 0. );
+            full_tensors( point, 0 ) = 5.;
+            full_tangents( point, 0 ) = 7.;
+        }
+    } );
+    for ( int point = 0; point < tangent_points; point++ ){
+        BOOST_TEST( single_stress[ 4 * point ] == 5.f );
+        BOOST_TEST( single_stress[ 4 * point + 1 ] == 1.f );
+        BOOST_TEST( DDSDDE[ 16 * point ] == 7.f );
+        BOOST_TEST( DDSDDE[ 16 * point + 1 ] == 0.f );
+    }
+
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::BatchConverter< double >( 4, 1 ), std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_CASE( testRotateNTENSVector ){
+    /*!
+     * Test the packed rotations against the rotation of the expanded full tensors
+     */
+
+    //Column major rotation about the axis ( 1, 2, 2 ) / 3 by 0.7 radians
+    const double angle = 0.7;
+    const std::array< double, 3 > axis = { 1. / 3, 2. / 3, 2. / 3 };
+    std::array< double, 9 > DROT;
+    for ( unsigned int i = 0; i < 3; i++ ){
+        for ( unsigned int j = 0; j < 3; j++ ){
+            double skew = 0;
+            if ( i != j ){
+                const unsigned int k = 3 - i - j;
+                skew = ( ( j == ( i + 1 ) % 3 ) ? -1. : 1. ) * axis[ k ];
+            }
+            DROT[ i + 3 * j ] = ( i == j ? std::cos( angle ) : 0. ) + ( 1 - std::cos( angle ) ) * axis[ i ] * axis[ j ]
+                              + std::sin( angle ) * skew;
+        }
+    }
+
+    auto rotateFull = [ & ]( const std::vector< double > &tensor ){
+        std::vector< double > rotated( 9, 0. );
+        for ( unsigned int i = 0; i < 3; i++ ){
+            for ( unsigned int j = 0; j < 3; j++ ){
+                for ( unsigned int k = 0; k < 3; k++ ){
+                    for ( unsigned int l = 0; l < 3; l++ ){
+                        rotated[ 3 * i + j ] += DROT[ i + 3 * k ] * tensor[ 3 * k + l ] * DROT[ j + 3 * l ];
+                    }
+                }
+            }
+        }
+        return rotated;
+    };
+
+    for ( auto ntens : { std::make_pair( 3, 3 ), std::make_pair( 3, 1 ), std::make_pair( 2, 1 ), std::make_pair( 3, 0 ) } ){
+        for ( bool abaqus_standard : { true, false } ){
+            for ( bool strain : { false, true } ){
+                const int NDI = ntens.first;
+                const int NSHR = ntens.second;
+                const int NTENS = NDI + NSHR;
+                const double shear = strain ? 2. : 1.;
+
+                std::vector< double > vector( NTENS );
+                for ( int component = 0; component < NTENS; component++ ){
+                    vector[ component ] = 1. + component * ( component - 1. );
+                }
+
+                //Reference: expand, rotate the full tensor, and contract. Strain-type shears are engineering shears.
+                std::vector< double > tensor_vector = vector;
+                for ( int component = NDI; component < NTENS; component++ ){
+                    tensor_vector[ component ] /= shear;
+                }
+                std::vector< double > answer = tardigradeAbaqusTools::contractFullNTENSTensor(
+                    rotateFull( tardigradeAbaqusTools::expandFullNTENSTensor( tensor_vector, NDI, NSHR, abaqus_standard ) ),
+                    NDI, NSHR, abaqus_standard );
+                for ( int component = NDI; component < NTENS; component++ ){
+                    answer[ component ] *= shear;
+                }
+
+                std::vector< double > result = vector;
+                tardigradeAbaqusTools::rotateNTENSVector( result.data( ), DROT.data( ), NDI, NSHR, strain, abaqus_standard );
+                BOOST_TEST( result == answer, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element( ) );
+
+                //Batched points each with their own rotation
+                const int npoints = 3;
+                std::vector< double > vectors( NTENS * npoints );
+                std::vector< double > rotations( 9 * npoints );
+                for ( int point = 0; point < npoints; point++ ){
+                    std::copy( vector.begin( ), vector.end( ), vectors.begin( ) + NTENS * point );
+                    for ( unsigned int index = 0; index < 9; index++ ){
+                        rotations[ 9 * point + index ] = point == 1 ? ( index % 4 == 0 ? 1. : 0. ) : DROT[ index ];
+                    }
+                }
+                tardigradeAbaqusTools::rotateNTENSVectorBatch( vectors.data( ), rotations.data( ), npoints, NDI, NSHR, strain,
+                                                               abaqus_standard );
+                for ( int point = 0; point < npoints; point++ ){
+                    const std::vector< double > point_result( vectors.begin( ) + NTENS * point, vectors.begin( ) + NTENS * ( point + 1 ) );
+                    BOOST_TEST( point_result == ( point == 1 ? vector : answer ),
+                                boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element( ) );
+                }
+
+                //VUMAT block with one row per point, including full tiles and a remainder
+                const int nblock = 2 * tardigradeAbaqusTools::rotationTileSize + 5;
+                std::vector< double > block( NTENS * nblock );
+                std::vector< double > rotation_block( 9 * nblock );
+                for ( int k = 0; k < nblock; k++ ){
+                    for ( int component = 0; component < NTENS; component++ ){
+                        block[ component * nblock + k ] = ( k + 1 ) * vector[ component ];
+                    }
+                    for ( unsigned int index = 0; index < 9; index++ ){
+                        rotation_block[ index * nblock + k ] = DROT[ index ];
+                    }
+                }
+                tardigradeAbaqusTools::rotateNTENSBlock( block.data( ), rotation_block.data( ), nblock, NDI, NSHR, strain,
+                                                         abaqus_standard );
+                for ( int k = 0; k < nblock; k++ ){
+                    for ( int component = 0; component < NTENS; component++ ){
+                        BOOST_TEST( block[ component * nblock + k ] == ( k + 1 ) * answer[ component ],
+                                    boost::test_tools::tolerance( 1e-12 ) );
+                    }
+                }
+            }
+        }
+    }
+
+    //Compile time overloads
+    std::vector< double > stress = { 1, 2, 3, 4, 5, 6 };
+    std::vector< double > answer = stress;
+    tardigradeAbaqusTools::rotateNTENSVector( answer.data( ), DROT.data( ), 3, 3, true, false );
+    tardigradeAbaqusTools::rotateNTENSVector< 3, 3, tardigradeAbaqusTools::AbaqusSolver::Explicit >( stress.data( ), DROT.data( ), true );
+    BOOST_TEST( stress == answer, boost::test_tools::per_element( ) );
+
+    //Single precision Explicit block rotated by double precision rotations
+    std::vector< float > block( 6, 1.f );
+    std::vector< double > rotation_block( DROT.begin( ), DROT.end( ) );
+    tardigradeAbaqusTools::rotateNTENSBlock< 3, 3, tardigradeAbaqusTools::AbaqusSolver::Explicit >( block.data( ), rotation_block.data( ), 1 );
+    std::vector< double > ones( 6, 1. );
+    tardigradeAbaqusTools::rotateNTENSVector( ones.data( ), DROT.data( ), 3, 3, false, false );
+    BOOST_TEST( std::vector< double >( block.begin( ), block.end( ) ) == ones,
+                boost::test_tools::tolerance( 1e-6 ) << boost::test_tools::per_element( ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( testNTENSAlgebra ){
+    /*!
+     * Test the packed tensor algebra against the expanded full tensors
+     */
+
+    for ( auto ntens : { std::make_pair( 3, 3 ), std::make_pair( 3, 1 ), std::make_pair( 2, 1 ) } ){
+        for ( bool abaqus_standard : { true, false } ){
+            tardigradeAbaqusTools::dispatchNTENS( ntens.first, ntens.second, [ & ]( auto ndi, auto nshr ){
+                tardigradeAbaqusTools::dispatchSolver( abaqus_standard, [ & ]( auto solver ){
+                    constexpr int NDI = decltype( ndi )::value;
+                    constexpr int NSHR = decltype( nshr )::value;
+                    constexpr int NTENS = NDI + NSHR;
+                    constexpr tardigradeAbaqusTools::AbaqusSolver SOLVER = decltype( solver )::value;
+
+                    std::vector< double > stress( NTENS ), strain( NTENS ), DDSDDE( NTENS * NTENS );
+                    for ( int component = 0; component < NTENS; component++ ){
+                        stress[ component ] = 1. + component * ( component - 1.5 );
+                        strain[ component ] = 0.25 - 0.5 * component;
+                    }
+                    for ( int index = 0; index < NTENS * NTENS; index++ ){
+                        DDSDDE[ index ] = 1. + index % ( NTENS + 1 ) + 0.1 * index;
+                    }
+
+                    //Reference full tensors. The strain has engineering shear strains.
+                    std::vector< double > tensor_strain = strain;
+                    for ( int component = NDI; component < NTENS; component++ ){
+                        tensor_strain[ component ] /= 2;
+                    }
+                    const std::vector< double > A = tardigradeAbaqusTools::expandFullNTENSTensor( stress, NDI, NSHR, abaqus_standard );
+                    const std::vector< double > B = tardigradeAbaqusTools::expandFullNTENSTensor( tensor_strain, NDI, NSHR, abaqus_standard );
+                    const double trace = A[ 0 ] + A[ 4 ] + A[ 8 ];
+                    std::vector< double > deviatoric = A;
+                    for ( unsigned int i = 0; i < 3; i++ ){
+                        deviatoric[ 4 * i ] -= trace / 3;
+                    }
+                    double AA = 0, AB = 0, BB = 0, ss = 0;
+                    for ( unsigned int index = 0; index < 9; index++ ){
+                        AA += A[ index ] * A[ index ];
+                        AB += A[ index ] * B[ index ];
+                        BB += B[ index ] * B[ index ];
+                        ss += deviatoric[ index ] * deviatoric[ index ];
+                    }
+                    const double determinant = A[ 0 ] * ( A[ 4 ] * A[ 8 ] - A[ 5 ] * A[ 7 ] )
+                                             - A[ 1 ] * ( A[ 3 ] * A[ 8 ] - A[ 5 ] * A[ 6 ] )
+                                             + A[ 2 ] * ( A[ 3 ] * A[ 7 ] - A[ 4 ] * A[ 6 ] );
+
+                    BOOST_TEST( ( tardigradeAbaqusTools::NTENSTrace< NDI, NSHR >( stress ) ) == trace,
+                                boost::test_tools::tolerance( 1e-12 ) );
+
+                    const std::array< double, NTENS > packed_deviatoric = tardigradeAbaqusTools::NTENSDeviatoric< NDI, NSHR >( stress.data( ) );
+                    const std::vector< double > deviatoric_answer = tardigradeAbaqusTools::contractFullNTENSTensor( deviatoric, NDI, NSHR,
+                                                                                                                   abaqus_standard );
+                    const std::vector< double > deviatoric_result( packed_deviatoric.begin( ), packed_deviatoric.end( ) );
+                    BOOST_TEST( deviatoric_result == deviatoric_answer,
+                                boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element( ) );
+
+                    BOOST_TEST( ( tardigradeAbaqusTools::NTENSDoubleContraction< NDI, NSHR >( stress, stress.data( ) ) ) == AA,
+                                boost::test_tools::tolerance( 1e-12 ) );
+                    BOOST_TEST( ( tardigradeAbaqusTools::NTENSWork< NDI, NSHR >( stress, strain ) ) == AB,
+                                boost::test_tools::tolerance( 1e-12 ) );
+                    BOOST_TEST( ( tardigradeAbaqusTools::NTENSNorm< NDI, NSHR >( stress ) ) == std::sqrt( AA ),
+                                boost::test_tools::tolerance( 1e-12 ) );
+                    BOOST_TEST( ( tardigradeAbaqusTools::NTENSNorm< NDI, NSHR >( strain, true ) ) == std::sqrt( BB ),
+                                boost::test_tools::tolerance( 1e-12 ) );
+                    BOOST_TEST( ( tardigradeAbaqusTools::NTENSVonMises< NDI, NSHR >( stress ) ) == std::sqrt( 1.5 * ss ),
+                                boost::test_tools::tolerance( 1e-12 ) );
+
+                    const std::array< double, 3 > invariants = tardigradeAbaqusTools::NTENSInvariants< NDI, NSHR, SOLVER >( stress );
+                    BOOST_TEST( invariants[ 0 ] == trace, boost::test_tools::tolerance( 1e-12 ) );
+                    BOOST_TEST( invariants[ 1 ] == 0.5 * ( trace * trace - AA ), boost::test_tools::tolerance( 1e-12 ) );
+                    BOOST_TEST( invariants[ 2 ] == determinant, boost::test_tools::tolerance( 1e-12 ) );
+
+                    const std::array< double, 3 > strain_invariants = tardigradeAbaqusTools::NTENSInvariants< NDI, NSHR, SOLVER >( strain, true );
+                    const std::array< double, 3 > tensor_strain_invariants = tardigradeAbaqusTools::NTENSInvariants< NDI, NSHR, SOLVER >( tensor_strain );
+                    BOOST_TEST( strain_invariants == tensor_strain_invariants,
+                                boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element( ) );
+
+                    const std::array< double, NTENS > product = tardigradeAbaqusTools::NTENSTangentProduct< NDI, NSHR >( DDSDDE.data( ), strain );
+                    for ( int row = 0; row < NTENS; row++ ){
+                        double answer = 0;
+                        for ( int col = 0; col < NTENS; col++ ){
+                            answer += DDSDDE[ col * NTENS + row ] * strain[ col ];
+                        }
+                        BOOST_TEST( product[ row ] == answer, boost::test_tools::tolerance( 1e-12 ) );
+                    }
+                } );
+            } );
+        }
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( testFullNTENSStrain ){
+    /*!
+     * Test the strain-type expansions and contractions against the stress-type conversions with separate shear scaling
+     */
+
+    for ( auto ntens : { std::make_pair( 3, 3 ), std::make_pair( 3, 1 ), std::make_pair( 2, 1 ) } ){
+        for ( bool abaqus_standard : { true, false } ){
+            const int NDI = ntens.first;
+            const int NSHR = ntens.second;
+            const int NTENS = NDI + NSHR;
+
+            std::vector< double > STRAN( NTENS );
+            for ( int component = 0; component < NTENS; component++ ){
+                STRAN[ component ] = 1. + component * ( component - 1.5 );
+            }
+
+            //Reference: expand the stress-type vector and halve the off-diagonal components
+            std::vector< double > answer = tardigradeAbaqusTools::expandFullNTENSTensor( STRAN, NDI, NSHR, abaqus_standard );
+            for ( unsigned int index = 0; index < 9; index++ ){
+                if ( index % 4 != 0 ){
+                    answer[ index ] /= 2;
+                }
+            }
+
+            std::vector< double > full_tensor( 9 );
+            tardigradeAbaqusTools::expandFullNTENSStrain( full_tensor, STRAN.data( ), NDI, NSHR, abaqus_standard );
+            BOOST_TEST( full_tensor == answer, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element( ) );
+
+            std::vector< double > result( NTENS );
+            tardigradeAbaqusTools::contractFullNTENSStrain( result.data( ), full_tensor, NDI, NSHR, abaqus_standard );
+            BOOST_TEST( result == STRAN, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element( ) );
+
+            //Compile time NDI, NSHR, and solver type
+            tardigradeAbaqusTools::dispatchNTENS( NDI, NSHR, [ & ]( auto ndi, auto nshr ){
+                tardigradeAbaqusTools::dispatchSolver( abaqus_standard, [ & ]( auto solver ){
+                    constexpr int CNDI = decltype( ndi )::value;
+                    constexpr int CNSHR = decltype( nshr )::value;
+                    constexpr tardigradeAbaqusTools::AbaqusSolver SOLVER = decltype( solver )::value;
+
+                    const std::array< double, 9 > full_array = tardigradeAbaqusTools::expandFullNTENSStrain< CNDI, CNSHR, SOLVER >( STRAN );
+                    const std::vector< double > full_result( full_array.begin( ), full_array.end( ) );
+                    BOOST_TEST( full_result == answer, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element( ) );
+
+                    const std::array< double, CNDI + CNSHR > vector_array = tardigradeAbaqusTools::contractFullNTENSStrain< CNDI, CNSHR, SOLVER >( full_array );
+                    const std::vector< double > vector_result( vector_array.begin( ), vector_array.end( ) );
+                    BOOST_TEST( vector_result == STRAN, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element( ) );
+                } );
+            } );
+
+            //Column major blocks
+            const int nblock = 5;
+            std::vector< double > abaqus_block( NTENS * nblock ), full_block( 9 * nblock ), block_result( NTENS * nblock );
+            for ( int component = 0; component < NTENS; component++ ){
+                for ( int k = 0; k < nblock; k++ ){
+                    abaqus_block[ component * nblock + k ] = ( k + 1 ) * STRAN[ component ];
+                }
+            }
+            tardigradeAbaqusTools::expandFullNTENSStrainBlock( full_block.data( ), abaqus_block.data( ), nblock, NDI, NSHR,
+                                                                true, abaqus_standard );
+            for ( unsigned int component = 0; component < 9; component++ ){
+                for ( int k = 0; k < nblock; k++ ){
+                    BOOST_TEST( full_block[ component * nblock + k ] == ( k + 1 ) * answer[ component ],
+                                boost::test_tools::tolerance( 1e-12 ) );
+                }
+            }
+            tardigradeAbaqusTools::contractFullNTENSStrainBlock( block_result.data( ), full_block.data( ), nblock, NDI, NSHR,
+                                                                  true, abaqus_standard );
+            BOOST_TEST( block_result == abaqus_block, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element( ) );
+
+            //Single precision block widened to double precision tensors
+            std::vector< float > float_block( abaqus_block.begin( ), abaqus_block.end( ) );
+            std::vector< double > widened_block( 9 * nblock );
+            tardigradeAbaqusTools::expandFullNTENSStrainBlock( widened_block.data( ), float_block.data( ), nblock, NDI, NSHR,
+                                                                true, abaqus_standard );
+            BOOST_TEST( widened_block == full_block, boost::test_tools::tolerance( 1e-6 ) << boost::test_tools::per_element( ) );
+
+            //Tensorial shear strains, e.g. the VUMAT strainInc, match the stress-type block conversions
+            std::vector< double > tensor_block( 9 * nblock ), tensorial_block( 9 * nblock );
+            tardigradeAbaqusTools::expandFullNTENSTensorBlock( tensor_block.data( ), abaqus_block.data( ), nblock, NDI, NSHR,
+                                                                abaqus_standard );
+            tardigradeAbaqusTools::expandFullNTENSStrainBlock( tensorial_block.data( ), abaqus_block.data( ), nblock, NDI, NSHR,
+                                                                false, abaqus_standard );
+            BOOST_TEST( tensorial_block == tensor_block, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element( ) );
+            tardigradeAbaqusTools::contractFullNTENSStrainBlock( block_result.data( ), tensorial_block.data( ), nblock, NDI, NSHR,
+                                                                  false, abaqus_standard );
+            BOOST_TEST( block_result == abaqus_block, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element( ) );
+        }
+    }
+
+    //Array-of-structures batches of expanded vectors
+    for ( bool abaqus_standard : { true, false } ){
+        const int npoints = 4;
+        std::vector< double > long_vectors( 6 * npoints ), full_tensors( 9 * npoints ), result( 6 * npoints );
+        for ( unsigned int index = 0; index < long_vectors.size( ); index++ ){
+            long_vectors[ index ] = 0.5 + index * ( index % 5 - 2. );
+        }
+        tardigradeAbaqusTools::expandFullNTENSStrainBatch( full_tensors.data( ), long_vectors.data( ), npoints, abaqus_standard );
+        for ( int point = 0; point < npoints; point++ ){
+            const std::vector< double > point_vector( long_vectors.begin( ) + 6 * point, long_vectors.begin( ) + 6 * ( point + 1 ) );
+            std::vector< double > answer( 9 );
+            tardigradeAbaqusTools::expandFullNTENSStrain( answer, point_vector, 3, 3, abaqus_standard );
+            const std::vector< double > point_result( full_tensors.begin( ) + 9 * point, full_tensors.begin( ) + 9 * ( point + 1 ) );
+            BOOST_TEST( point_result == answer, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element( ) );
+        }
+        tardigradeAbaqusTools::contractFullNTENSStrainBatch( result.data( ), full_tensors.data( ), npoints, abaqus_standard );
+        BOOST_TEST( result == long_vectors, boost::test_tools::tolerance( 1e-12 ) << boost::test_tools::per_element( ) );
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( testBumpArena ){
+    /*!
+     * Test the bump arena allocation, reclamation, and heap fallback
+     */
+
+    alignas( 64 ) unsigned char buffer[ 256 ];
+    tardigradeAbaqusTools::BumpArena arena( buffer, sizeof( buffer ) );
+    BOOST_TEST( arena.capacity( ) == 256 );
+    BOOST_TEST( arena.used( ) == 0 );
+
+    //Aligned allocations advance the offset
+    void *first = arena.allocate( 3, 1 );
+    void *second = arena.allocate( 16, 16 );
+    BOOST_TEST( first == static_cast< void* >( buffer ) );
+    BOOST_TEST( second == static_cast< void* >( buffer + 16 ) );
+    BOOST_TEST( arena.used( ) == 32 );
+
+    //Only the most recent allocation is reclaimed
+    arena.deallocate( first, 3 );
+    BOOST_TEST( arena.used( ) == 32 );
+    arena.deallocate( second, 16 );
+    BOOST_TEST( arena.used( ) == 16 );
+
+    //Requests larger than the remaining buffer fall back to the heap
+    void *large = arena.allocate( 512 );
+    BOOST_TEST( arena.heapAllocations( ) == 1 );
+    BOOST_TEST( arena.used( ) == 16 );
+    arena.deallocate( large, 512 );
+
+    //Over-aligned heap fallbacks keep the requested alignment
+    void *aligned = arena.allocate( 512, 128 );
+    BOOST_TEST( arena.heapAllocations( ) == 2 );
+    BOOST_TEST( reinterpret_cast< std::uintptr_t >( aligned ) % 128 == 0 );
+    arena.deallocate( aligned, 512, 128 );
+
+    arena.reset( );
+    BOOST_TEST( arena.used( ) == 0 );
+
+    //The per-thread arena is the same object for repeated calls
+    BOOST_TEST( &tardigradeAbaqusTools::threadArena( ) == &tardigradeAbaqusTools::threadArena( ) );
+    BOOST_TEST( tardigradeAbaqusTools::threadArena( ).capacity( ) == tardigradeAbaqusTools::defaultArenaCapacity );
+}
+
+BOOST_AUTO_TEST_CASE( testArenaAllocator ){
+    /*!
+     * Test that the converters propagate the allocator of their vector arguments
+     */
+
+    typedef tardigradeAbaqusTools::ArenaAllocator< double > allocator_type;
+    typedef std::vector< double, allocator_type > arena_vector;
+
+    tardigradeAbaqusTools::BumpArena arena( 4096 );
+    allocator_type allocator( arena );
+
+    {
+        std::vector< double > STRESS = { 11, 22, 33, 12 };
+        arena_vector stress( STRESS.begin( ), STRESS.end( ), allocator );
+
+        arena_vector full_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( stress, 3, 1 );
+        BOOST_TEST( full_tensor.get_allocator( ).arena( ) == &arena );
+        std::vector< double > expected_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( STRESS, 3, 1 );
+        BOOST_TEST( std::vector< double >( full_tensor.begin( ), full_tensor.end( ) ) == expected_tensor,
+                    boost::test_tools::per_element() );
+
+        arena_vector long_vector = tardigradeAbaqusTools::expandAbaqusNTENSVector( stress, 3, 1 );
+        arena_vector abaqus_vector = tardigradeAbaqusTools::contractAbaqusNTENSVector( long_vector, 3, 1 );
+        arena_vector round_trip = tardigradeAbaqusTools::contractFullNTENSTensor(
+            tardigradeAbaqusTools::expandFullNTENSTensor( long_vector ), 3, 1 );
+        BOOST_TEST( std::vector< double >( abaqus_vector.begin( ), abaqus_vector.end( ) ) == STRESS,
+                    boost::test_tools::per_element() );
+        BOOST_TEST( std::vector< double >( round_trip.begin( ), round_trip.end( ) ) == STRESS,
+                    boost::test_tools::per_element() );
+
+        //Views take the allocator as an argument
+        tardigradeAbaqusTools::ColumnMajorView< const double > stress_view( STRESS.data( ), 4, 1 );
+        arena_vector view_tensor = tardigradeAbaqusTools::expandFullNTENSTensor( stress_view, 3, 1, true, allocator );
+        BOOST_TEST( view_tensor.get_allocator( ).arena( ) == &arena );
+        BOOST_TEST( std::vector< double >( view_tensor.begin( ), view_tensor.end( ) ) == expected_tensor,
+                    boost::test_tools::per_element() );
+
+        //Rows and outer vectors of matrices share the arena
+        std::vector< double > DDSDDE = { 1, 2, 3,
+                                         4, 5, 6,
+                                         7, 8, 9 };
+        tardigradeAbaqusTools::VectorOfVectors< double, allocator_type > abaqus_matrix =
+            tardigradeAbaqusTools::columnToRowMajor( DDSDDE.data( ), 3, 3, allocator );
+        BOOST_TEST( abaqus_matrix.get_allocator( ).arena( ) == &arena );
+        BOOST_TEST( abaqus_matrix[ 2 ].get_allocator( ).arena( ) == &arena );
+        BOOST_TEST( abaqus_matrix[ 0 ][ 1 ] == 4 );
+
+        tardigradeAbaqusTools::VectorOfVectors< double, allocator_type > full_matrix =
+            tardigradeAbaqusTools::expandFullNTENSMatrix( abaqus_matrix, 2, 1 );
+        BOOST_TEST( full_matrix[ 8 ].get_allocator( ).arena( ) == &arena );
+        BOOST_TEST( tardigradeAbaqusTools::contractFullNTENSMatrix( full_matrix, 2, 1 ) == abaqus_matrix );
+
+        std::vector< double > column_major( 9 );
+        tardigradeAbaqusTools::rowToColumnMajor( column_major.data( ), abaqus_matrix, 3, 3 );
+        BOOST_TEST( column_major == DDSDDE, boost::test_tools::per_element() );
+
+        BOOST_TEST( arena.used( ) > 0 );
+        BOOST_TEST( arena.heapAllocations( ) == 0 );
+    }
+
+    //Reset at the end of the material call
+    arena.reset( );
+    BOOST_TEST( arena.used( ) == 0 );
+}
+
+BOOST_AUTO_TEST_CASE( testWorkspace ){
+    /*!
+     * Test the per-thread integration point workspace and its increment invalidation
+     */
+
+    tardigradeAbaqusTools::Workspace< double > workspace;
+    double STATEV[ 3 ] = { 1, 2, 3 };
+
+    BOOST_TEST( workspace.beginIncrement( 1, 1 ) );
+    BOOST_TEST( !workspace.beginIncrement( 1, 1 ) );
+
+    tardigradeAbaqusTools::PointWorkspace< double > &point = workspace.point( 10, 1 );
+    BOOST_TEST( &workspace.point( 10, 1 ) == &point );
+    BOOST_TEST( &workspace.point( 10, 2 ) != &point );
+    BOOST_TEST( &workspace.point( 11, 1 ) != &point );
+    BOOST_TEST( workspace.size( ) == 3 );
+
+    //The state variables are copied once per increment
+    BOOST_TEST( !point.statev_valid );
+    const std::vector< double > &statev = point.stateVariables( STATEV, 3 );
+    BOOST_TEST( statev == std::vector< double >( { 1, 2, 3 } ), boost::test_tools::per_element() );
+    const double *statev_data = statev.data( );
+    STATEV[ 0 ] = 4;
+    BOOST_TEST( workspace.point( 10, 1 ).stateVariables( STATEV, 3 )[ 0 ] == 1 );
+
+    //A new increment invalidates the cache and keeps the buffers
+    point.stress[ 0 ] = 5;
+    BOOST_TEST( !workspace.beginIncrement( 1, 1 ) );
+    BOOST_TEST( workspace.point( 10, 1, 1, 2 ).stateVariables( STATEV, 3 )[ 0 ] == 4 );
+    BOOST_TEST( point.statev.data( ) == statev_data );
+    BOOST_TEST( point.stress[ 0 ] == 5 );
+
+    //A new step invalidates the cache
+    STATEV[ 0 ] = 6;
+    BOOST_TEST( workspace.beginIncrement( 2, 2 ) );
+    BOOST_TEST( workspace.point( 10, 1 ).stateVariables( STATEV, 3 )[ 0 ] == 6 );
+
+    //Manual invalidation for re-attempted increments
+    STATEV[ 0 ] = 7;
+    BOOST_TEST( workspace.point( 10, 1 ).stateVariables( STATEV, 3 )[ 0 ] == 6 );
+    workspace.invalidate( );
+    BOOST_TEST( workspace.point( 10, 1 ).stateVariables( STATEV, 3 )[ 0 ] == 7 );
+
+    //Section points of the same element and integration point do not share a workspace
+    double top[ 3 ] = { 8, 0, 0 };
+    double bottom[ 3 ] = { 9, 0, 0 };
+    tardigradeAbaqusTools::PointWorkspace< double > &solid = workspace.point( 10, 1 );
+    BOOST_TEST( &workspace.sectionPoint( 10, 1, 1, 1 ) == &solid );
+    tardigradeAbaqusTools::PointWorkspace< double > &top_point = workspace.point( 20, 1, 1, 5, 2, 2 );
+    tardigradeAbaqusTools::PointWorkspace< double > &bottom_point = workspace.point( 20, 1, 2, 1, 2, 2 );
+    BOOST_TEST( &top_point != &bottom_point );
+    BOOST_TEST( &workspace.sectionPoint( 20, 1, 1, 1 ) != &top_point );
+    BOOST_TEST( top_point.stateVariables( top, 3 )[ 0 ] == 8 );
+    BOOST_TEST( bottom_point.stateVariables( bottom, 3 )[ 0 ] == 9 );
+    BOOST_TEST( workspace.sectionPoint( 20, 1, 1, 5 ).stateVariables( bottom, 3 )[ 0 ] == 8 );
+
+    workspace.clear( );
+    BOOST_TEST( workspace.size( ) == 0 );
+    BOOST_TEST( workspace.beginIncrement( 2, 2 ) );
+
+    BOOST_TEST( &tardigradeAbaqusTools::threadWorkspace( ) == &tardigradeAbaqusTools::threadWorkspace< double >( ) );
+
+}
+
+struct PlasticStrain{ static constexpr int components = 6; };
+struct EquivalentPlasticStrain{ static constexpr int components = 1; };
+struct Damage{ static constexpr int components = 2; };
+struct BackStress{ static constexpr int components = 6; };
+
+BOOST_AUTO_TEST_CASE( testStateVariableLayout ){
+    /*!
+     * Test the named state variable layout and zero-copy accessors over column major state arrays
+     */
+
+    using Layout = tardigradeAbaqusTools::StateVariableLayout< PlasticStrain, EquivalentPlasticStrain, Damage, BackStress >;
+    static_assert( Layout::count == 4 );
+    static_assert( Layout::size == 15 );
+    static_assert( Layout::offset< PlasticStrain >( ) == 0 );
+    static_assert( Layout::offset< EquivalentPlasticStrain >( ) == 6 );
+    static_assert( Layout::offset< Damage >( ) == 7 );
+    static_assert( Layout::offset< BackStress >( ) == 9 );
+    static_assert( Layout::components< Damage >( ) == 2 );
+    static_assert( !Layout::contains< int > );
+
+    //Column major stateOld( nblock, nstatev ) with the value encoding the point and state variable index
+    const int nblock = 3;
+    const int nstatev = 16;
+    std::vector< double > stateOld( nblock * nstatev );
+    for ( int j = 0; j < nstatev; j++ ){
+        for ( int k = 0; k < nblock; k++ ){
+            stateOld[ j * nblock + k ] = 100 * j + k;
+        }
+    }
+
+    tardigradeAbaqusTools::StateVariables< Layout, const double > old_state( stateOld.data( ), nblock, nstatev );
+    BOOST_TEST( old_state.get< EquivalentPlasticStrain >( 2 ) == 602 );
+    BOOST_TEST( old_state.get< Damage >( 1, 1 ) == 801 );
+    BOOST_TEST( &old_state.get< PlasticStrain >( ) == stateOld.data( ) );
+
+    tardigradeAbaqusTools::ColumnMajorView< const double > back_stress = old_state.view< BackStress >( );
+    BOOST_TEST( back_stress.height( ) == nblock );
+    BOOST_TEST( back_stress.width( ) == 6 );
+    BOOST_TEST( back_stress( 2, 5 ) == 1402 );
+
+    //Writes through the accessors land in the Fortran array
+    std::vector< double > stateNew( nblock * nstatev, -666 );
+    tardigradeAbaqusTools::StateVariables< Layout > new_state( stateNew.data( ), nblock, nstatev );
+    new_state.get< Damage >( 0, 1 ) = 1;
+    new_state.view< PlasticStrain >( )( 1, 2 ) = 2;
+    BOOST_TEST( stateNew[ 8 * nblock ] == 1 );
+    BOOST_TEST( stateNew[ 2 * nblock + 1 ] == 2 );
+
+    //Bulk copies of the listed and of the unchanged variables
+    Layout::copy< Damage >( stateNew.data( ), stateOld.data( ), nblock );
+    BOOST_TEST( std::equal( stateNew.begin( ) + 7 * nblock, stateNew.begin( ) + 9 * nblock, stateOld.begin( ) + 7 * nblock ) );
+    BOOST_TEST( stateNew[ 6 * nblock ] == -666 );
+
+    std::fill( stateNew.begin( ), stateNew.end( ), -666 );
+    Layout::copyUnchanged< EquivalentPlasticStrain, BackStress >( stateNew.data( ), stateOld.data( ), nblock );
+    for ( int j = 0; j < nstatev; j++ ){
+        const bool copied = ( j < 6 ) || ( j == 7 ) || ( j == 8 );
+        for ( int k = 0; k < nblock; k++ ){
+            BOOST_TEST( stateNew[ j * nblock + k ] == ( copied ? stateOld[ j * nblock + k ] : -666 ) );
+        }
+    }
+
+    std::fill( stateNew.begin( ), stateNew.end( ), -666 );
+    Layout::copyUnchanged( stateNew.data( ), stateOld.data( ), nblock );
+    BOOST_TEST( std::equal( stateNew.begin( ), stateNew.begin( ) + Layout::size * nblock, stateOld.begin( ) ) );
+    BOOST_TEST( stateNew[ Layout::size * nblock ] == -666 );
+
+    //The UMAT STATEV array is a block of one point
+    double STATEV[ 15 ] = { };
+    tardigradeAbaqusTools::StateVariables< Layout > statev( STATEV );
+    statev.get< BackStress >( 0, 3 ) = 5;
+    BOOST_TEST( STATEV[ 12 ] == 5 );
+
+    BOOST_CHECK_THROW( ( tardigradeAbaqusTools::StateVariables< Layout >( STATEV, 1, 14 ) ), std::length_error );
+
+}
+
+BOOST_AUTO_TEST_CASE( testInstrumentation ){
+    /*!
+     * Test the per-thread converter instrumentation counters and reports
+     */
+
+    tardigradeAbaqusTools::InstrumentationRegistry &registry = tardigradeAbaqusTools::InstrumentationRegistry::instance( );
+    registry.reset( );
+
+    const std::size_t expand = static_cast< std::size_t >( tardigradeAbaqusTools::Converter::expandAbaqusNTENSVector );
+    const std::size_t contract = static_cast< std::size_t >( tardigradeAbaqusTools::Converter::contractFullNTENSMatrix );
+
+    //Nested scopes are counted once by the outermost scope
+    {
+        tardigradeAbaqusTools::ScopedInstrumentation outer( tardigradeAbaqusTools::Converter::expandAbaqusNTENSVector, 10 );
+        tardigradeAbaqusTools::ScopedInstrumentation inner( tardigradeAbaqusTools::Converter::contractFullNTENSMatrix, 20 );
+    }
+    tardigradeAbaqusTools::InstrumentationRecords records = registry.totals( );
+    BOOST_TEST( records[ expand ].calls == 1 );
+    BOOST_TEST( records[ expand ].bytes == 10 );
+    BOOST_TEST( records[ expand ].timed_calls <= 1 );
+    if ( tardigradeAbaqusTools::instrumentationSamplePeriod == 1 ){
+        BOOST_TEST( records[ expand ].timed_calls == 1 );
+    }
+    BOOST_TEST( records[ contract ].calls == 0 );
+    BOOST_TEST( tardigradeAbaqusTools::threadInstrumentation( ).depth == 0 );
+
+#if TARDIGRADE_ABAQUS_TOOLS_INSTRUMENTATION
+    //The converters count calls and the bytes read and written
+    registry.reset( );
+    std::vector< double > abaqus_vector = { 1, 2, 3, 4 };
+    tardigradeAbaqusTools::expandAbaqusNTENSVector( abaqus_vector, 3, 1 );
+    tardigradeAbaqusTools::expandAbaqusNTENSVector( abaqus_vector, 3, 1 );
+    std::vector< std::vector< double > > full_matrix( 9, std::vector< double >( 9 ) );
+    tardigradeAbaqusTools::contractFullNTENSMatrix( full_matrix, 3, 1 );
+    records = registry.totals( );
+    BOOST_TEST( records[ expand ].calls == 2 );
+    BOOST_TEST( records[ expand ].bytes == 2 * 10 * sizeof( double ) );
+    BOOST_TEST( records[ contract ].calls == 1 );
+    BOOST_TEST( records[ contract ].bytes == ( 81 + 16 ) * sizeof( double ) );
+#endif
+
+    std::ostringstream csv;
+    tardigradeAbaqusTools::writeInstrumentationCSV( csv, records );
+    BOOST_TEST( csv.str( ).find( std::string( "converter,calls,bytes,timed_calls," ) + tardigradeAbaqusTools::cycleCounterUnit + "\n" ) == 0 );
+    BOOST_TEST( csv.str( ).find( "\nexpandAbaqusNTENSVector," + std::to_string( records[ expand ].calls ) + "," ) !=
+                std::string::npos );
+
+    std::ostringstream json;
+    tardigradeAbaqusTools::writeInstrumentationJSON( json, records );
+    BOOST_TEST( json.str( ).find( "\"expandAbaqusNTENSVector\": { \"calls\": " + std::to_string( records[ expand ].calls ) ) !=
+                std::string::npos );
+    BOOST_TEST( json.str( ).find( "\"contractFullNTENSTensorBatch\"" ) != std::string::npos );
+
+    registry.reset( );
+    BOOST_TEST( registry.totals( )[ expand ].calls == 0 );
+
+}
+
+BOOST_AUTO_TEST_CASE( testFtoStringView ){
+    /*!
+     * Test the allocation free Fortran string trim and the material name cache
+     */
+
+    char CMNAME[] = "STEEL       ";
+    const int length = 12;
+
+    std::string_view name = tardigradeAbaqusTools::FtoStringView( length, CMNAME );
+    BOOST_TEST( name == "STEEL" );
+    BOOST_TEST( name.data( ) == CMNAME );
+
+    char blank[] = "    ";
+    BOOST_TEST( tardigradeAbaqusTools::FtoStringView( 4, blank ).empty( ) );
+
+    //Negative lengths are empty strings, not huge views
+    BOOST_TEST( tardigradeAbaqusTools::FtoStringView( -1, CMNAME ).empty( ) );
+    BOOST_TEST( tardigradeAbaqusTools::MaterialNameCache( ).intern( -1, CMNAME ).empty( ) );
+
+    //Repeat lookups hit the same interned name
+    tardigradeAbaqusTools::MaterialNameCache cache;
+    std::string_view interned = cache.intern( length, CMNAME );
+    BOOST_TEST( interned == "STEEL" );
+    BOOST_TEST( cache.intern( length, CMNAME ).data( ) == interned.data( ) );
+    BOOST_TEST( cache.size( ) == 1 );
+
+    //Re-used buffers are re-interned without changing the views handed out earlier
+    std::memcpy( CMNAME, "COPPER", 6 );
+    BOOST_TEST( cache.intern( length, CMNAME ) == "COPPER" );
+    BOOST_TEST( interned == "STEEL" );
+    BOOST_TEST( cache.size( ) == 2 );
+
+    //Names longer than the small string buffer survive a re-use of the buffer
+    char long_name[ 81 ];
+    std::memset( long_name, ' ', 80 );
+    std::memcpy( long_name, "ALUMINUM_ALLOY_6061_T6", 22 );
+    const std::string_view aluminum = cache.intern( 80, long_name );
+    std::memset( long_name, ' ', 80 );
+    std::memcpy( long_name, "TITANIUM_ALLOY_TI6AL4V", 22 );
+    BOOST_TEST( cache.intern( 80, long_name ) == "TITANIUM_ALLOY_TI6AL4V" );
+    BOOST_TEST( aluminum == "ALUMINUM_ALLOY_6061_T6" );
+
+    //Returning to an earlier name re-uses the interned copy
+    std::memset( long_name, ' ', 80 );
+    std::memcpy( long_name, "ALUMINUM_ALLOY_6061_T6", 22 );
+    BOOST_TEST( cache.intern( 80, long_name ).data( ) == aluminum.data( ) );
+    BOOST_TEST( cache.size( ) == 4 );
+
+    BOOST_TEST( tardigradeAbaqusTools::internMaterialName( length, CMNAME ) == "COPPER" );
+    cache.clear( );
+    BOOST_TEST( cache.size( ) == 0 );
+}
+
+BOOST_AUTO_TEST_CASE( testBlockedTranspose ){
+    /*!
+     * Test the pointer row and column major conversions above and below the blocked transpose threshold and the in
+     * place square transpose
+     */
+
+    for ( auto shape : { std::array< int, 2 >{ 2, 3 }, std::array< int, 2 >{ 97, 131 }, std::array< int, 2 >{ 1, 5000 } } ){
+        const int height = shape[ 0 ];
+        const int width = shape[ 1 ];
+
+        std::vector< double > row_major( height * width );
+        for ( unsigned int index = 0; index < row_major.size( ); index++ ){
+            row_major[ index ] = index;
+        }
+
+        std::vector< double > expected( height * width );
+        for ( int row = 0; row < height; row++ ){
+            for ( int col = 0; col < width; col++ ){
+                expected[ col * height + row ] = row_major[ row * width + col ];
+            }
+        }
+
+        std::vector< double > column_major( height * width, -666. );
+        tardigradeAbaqusTools::rowToColumnMajor( column_major.data( ), row_major.data( ), height, width );
+        BOOST_TEST( column_major == expected, boost::test_tools::per_element() );
+
+        std::vector< double > result( height * width, -666. );
+        tardigradeAbaqusTools::columnToRowMajor( column_major.data( ), result.data( ), height, width );
+        BOOST_TEST( result == row_major, boost::test_tools::per_element() );
+
+        //Vector of vectors conversions take the same blocked path
+        const std::vector< std::vector< double > > row_major_array = tardigradeAbaqusTools::columnToRowMajor( column_major.data( ),
+                                                                                                              height, width );
+        BOOST_TEST( row_major_array.size( ) == height );
+        for ( int row = 0; row < height; row++ ){
+            const std::vector< double > row_answer( row_major.begin( ) + row * width, row_major.begin( ) + ( row + 1 ) * width );
+            BOOST_TEST( row_major_array[ row ] == row_answer, boost::test_tools::per_element() );
+        }
+
+        std::vector< double > array_result( height * width, -666. );
+        tardigradeAbaqusTools::rowToColumnMajor( array_result.data( ), row_major_array, height, width );
+        BOOST_TEST( array_result == expected, boost::test_tools::per_element() );
+    }
+
+    //In place transpose of square arrays
+    for ( int size : { 3, 70 } ){
+        std::vector< int > array( size * size );
+        std::vector< int > expected( size * size );
+        for ( int row = 0; row < size; row++ ){
+            for ( int col = 0; col < size; col++ ){
+                array[ row * size + col ] = row * size + col;
+                expected[ col * size + row ] = row * size + col;
+            }
+        }
+        tardigradeAbaqusTools::transposeInPlace( array.data( ), size );
+        BOOST_TEST( array == expected, boost::test_tools::per_element() );
+    }
+}
@@ -0,0 +1,533 @@
+/**
+  * \file test_tardigrade_abaqus_tools_io.cpp
+  *
+  * Tests for the trace input and output of tardigrade_abaqus_tools
+  */
+
+
+#define BOOST_TEST_MODULE test_tardigrade_abaqus_tools_io
+#include <boost/test/included/unit_test.hpp>
+
+#include<cstdio>
+#include<filesystem>
+
+#include<tardigrade_abaqus_tools_io.h>
+
+namespace{
+
+    std::string temporaryFile( const std::string &name ){
+        /*!
+         * \param &name: The file name
+         * \returns A path in the temporary directory unique to this process
+         */
+        return ( std::filesystem::temp_directory_path( ) /
+                 ( "test_tardigrade_abaqus_tools_io_" + std::to_string( ::getpid( ) ) + "_" + name ) ).string( );
+    }
+
+    std::vector< double > sequence( const int &size, const double &start ){
+        /*!
+         * \param &size: The number of values
+         * \param &start: The first value
+         * \returns The values start, start + 1, ...
+         */
+        std::vector< double > values( size );
+        for ( int index = 0; index < size; index++ ){
+            values[ index ] = start + index;
+        }
+        return values;
+    }
+
+    struct RecordedCall{
+        /*!
+         * The arguments of a fake UMAT call
+         */
+
+        RecordedCall( const int &NDI, const int &NSHR, const int &NSTATV, const std::string &CMNAME, const double &start ) :
+            NDI( NDI ), NSHR( NSHR ), NSTATV( NSTATV ), CMNAME( CMNAME ){
+            const int NTENS = NDI + NSHR;
+            STRESS = sequence( NTENS, start );
+            STATEV = sequence( NSTATV, start + 100 );
+            DDSDDE = sequence( NTENS * NTENS, start + 200 );
+            STRAN = sequence( NTENS, start + 300 );
+            DSTRAN = sequence( NTENS, start + 400 );
+        }
+
+        void record( tardigradeAbaqusTools::UMATRecorder &recorder ) const{
+            recorder.record( STRESS.data( ), STATEV.data( ), DDSDDE.data( ), STRAN.data( ), DSTRAN.data( ), NDI, NSHR,
+                             NSTATV, CMNAME.data( ), CMNAME.size( ) );
+        }
+
+        int NDI;
+
+        int NSHR;
+
+        int NSTATV;
+
+        //! The Fortran material name including the trailing blanks
+        std::string CMNAME;
+
+        std::vector< double > STRESS, STATEV, DDSDDE, STRAN, DSTRAN;
+
+    };
+
+    struct RecordedBlock{
+        /*!
+         * The arguments of a fake VUMAT call
+         */
+
+        RecordedBlock( const int &nblock, const int &ndir, const int &nshr, const int &nstatev, const std::string &cmname,
+                       const double &start ) :
+            nblock( nblock ), ndir( ndir ), nshr( nshr ), nstatev( nstatev ), cmname( cmname ){
+            const int ntens = ndir + nshr;
+            stressOld = sequence( nblock * ntens, start );
+            stateOld = sequence( nblock * nstatev, start + 100 );
+            strainInc = sequence( nblock * ntens, start + 200 );
+        }
+
+        void record( tardigradeAbaqusTools::VUMATRecorder &recorder ) const{
+            recorder.record( stressOld.data( ), stateOld.data( ), strainInc.data( ), nblock, ndir, nshr, nstatev,
+                             cmname.data( ), cmname.size( ) );
+        }
+
+        int nblock;
+
+        int ndir;
+
+        int nshr;
+
+        int nstatev;
+
+        //! The Fortran material name including the trailing blanks
+        std::string cmname;
+
+        std::vector< double > stressOld, stateOld, strainInc;
+
+    };
+
+}
+
+BOOST_AUTO_TEST_CASE( testMappedFile ){
+    /*!
+     * Test the read-only file mapping
+     */
+
+    const std::string filename = temporaryFile( "mapped" );
+    {
+        std::ofstream file( filename, std::ios::binary );
+        file << "abaqus";
+    }
+
+    tardigradeAbaqusTools::MappedFile mapped( filename );
+    BOOST_TEST( mapped.size( ) == 6 );
+    BOOST_TEST( std::string( mapped.data( ), mapped.size( ) ) == "abaqus" );
+
+    tardigradeAbaqusTools::MappedFile moved( std::move( mapped ) );
+    BOOST_TEST( mapped.data( ) == nullptr );
+    BOOST_TEST( mapped.size( ) == 0 );
+    BOOST_TEST( std::string( moved.data( ), moved.size( ) ) == "abaqus" );
+
+    std::remove( filename.c_str( ) );
+
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::MappedFile{ filename }, std::runtime_error );
+
+}
+
+BOOST_AUTO_TEST_CASE( testUMATTraceRoundTrip ){
+    /*!
+     * Test recording and reading UMAT calls of several element types
+     */
+
+    const std::string filename = temporaryFile( "round_trip" );
+    const std::vector< RecordedCall > calls = { RecordedCall( 3, 3, 2, "STEEL   ", 1 ),
+                                                RecordedCall( 2, 1, 0, "PLANE STRESS", 1000 ),
+                                                RecordedCall( 3, 1, 5, "AXI", 2000 ) };
+    {
+        tardigradeAbaqusTools::UMATRecorder recorder( filename );
+        for ( const RecordedCall &call : calls ){
+            call.record( recorder );
+        }
+        BOOST_TEST( recorder.records( ) == calls.size( ) );
+    }
+
+    const tardigradeAbaqusTools::UMATTrace trace( filename );
+    BOOST_TEST( trace.size( ) == calls.size( ) );
+
+    for ( std::size_t index = 0; index < calls.size( ); index++ ){
+        const RecordedCall &call = calls[ index ];
+        const tardigradeAbaqusTools::UMATTraceRecord record = trace[ index ];
+        const int NTENS = call.NDI + call.NSHR;
+
+        BOOST_TEST( record.NDI == call.NDI );
+        BOOST_TEST( record.NSHR == call.NSHR );
+        BOOST_TEST( record.NTENS( ) == NTENS );
+        BOOST_TEST( record.NSTATV == call.NSTATV );
+        BOOST_TEST( std::string( record.CMNAME ) == std::string( tardigradeAbaqusTools::FtoStringView( call.CMNAME.size( ), call.CMNAME.data( ) ) ) );
+        BOOST_TEST( reinterpret_cast< std::uintptr_t >( record.STRESS ) % alignof( double ) == 0 );
+
+        BOOST_TEST( std::vector< double >( record.STRESS, record.STRESS + NTENS ) == call.STRESS, boost::test_tools::per_element( ) );
+        BOOST_TEST( std::vector< double >( record.STATEV, record.STATEV + call.NSTATV ) == call.STATEV, boost::test_tools::per_element( ) );
+        BOOST_TEST( std::vector< double >( record.DDSDDE, record.DDSDDE + NTENS * NTENS ) == call.DDSDDE, boost::test_tools::per_element( ) );
+        BOOST_TEST( std::vector< double >( record.STRAN, record.STRAN + NTENS ) == call.STRAN, boost::test_tools::per_element( ) );
+        BOOST_TEST( std::vector< double >( record.DSTRAN, record.DSTRAN + NTENS ) == call.DSTRAN, boost::test_tools::per_element( ) );
+    }
+
+    std::remove( filename.c_str( ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( testUMATTraceErrors ){
+    /*!
+     * Test the rejection of files that are not complete UMAT traces
+     */
+
+    const std::string filename = temporaryFile( "errors" );
+
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::UMATTrace{ filename }, std::runtime_error );
+
+    {
+        std::ofstream file( filename, std::ios::binary );
+        file << "not a UMAT trace file";
+    }
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::UMATTrace{ filename }, std::runtime_error );
+
+    {
+        tardigradeAbaqusTools::UMATRecorder recorder( filename );
+        RecordedCall( 3, 3, 4, "STEEL", 1 ).record( recorder );
+    }
+    const std::size_t size = std::filesystem::file_size( filename );
+    BOOST_TEST( size == sizeof( tardigradeAbaqusTools::UMATTraceFileHeader ) +
+                        tardigradeAbaqusTools::umatTraceRecordSize( 6, 4, 5 ) );
+    BOOST_TEST( tardigradeAbaqusTools::UMATTrace( filename ).size( ) == 1 );
+
+    std::filesystem::resize_file( filename, size - sizeof( double ) );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::UMATTrace{ filename }, std::runtime_error );
+
+    //A corrupt state variable count near INT_MAX is rejected without overflowing the record size
+    {
+        tardigradeAbaqusTools::UMATTraceRecordHeader record{ 3, 3, std::numeric_limits< std::int32_t >::max( ), 5 };
+        std::fstream file( filename, std::ios::binary | std::ios::in | std::ios::out );
+        file.seekp( sizeof( tardigradeAbaqusTools::UMATTraceFileHeader ) );
+        file.write( reinterpret_cast< const char* >( &record ), sizeof( record ) );
+    }
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::UMATTrace{ filename }, std::runtime_error );
+    BOOST_TEST( tardigradeAbaqusTools::umatTraceRecordSize( 6, std::numeric_limits< int >::max( ), 0 ) >
+                sizeof( double ) * std::size_t( std::numeric_limits< int >::max( ) ) );
+
+    std::filesystem::resize_file( filename, sizeof( tardigradeAbaqusTools::UMATTraceFileHeader ) );
+    BOOST_TEST( tardigradeAbaqusTools::UMATTrace( filename ).size( ) == 0 );
+
+    std::remove( filename.c_str( ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( testReplayUMATTrace ){
+    /*!
+     * Test replaying a trace through a model that updates the writable arrays
+     */
+
+    const std::string filename = temporaryFile( "replay" );
+    const std::vector< RecordedCall > calls = { RecordedCall( 3, 3, 3, "STEEL", 1 ),
+                                                RecordedCall( 3, 1, 1, "AXI", 10 ) };
+    {
+        tardigradeAbaqusTools::UMATRecorder recorder( filename );
+        for ( const RecordedCall &call : calls ){
+            call.record( recorder );
+        }
+    }
+
+    const tardigradeAbaqusTools::UMATTrace trace( filename );
+    std::size_t index = 0;
+    tardigradeAbaqusTools::replayUMATTrace( trace, [ & ]( tardigradeAbaqusTools::UMATReplayCall &call ){
+        const RecordedCall &recorded = calls[ index ];
+        const int NTENS = call.NDI + call.NSHR;
+        BOOST_TEST( call.NDI == recorded.NDI );
+        BOOST_TEST( call.NSHR == recorded.NSHR );
+        BOOST_TEST( call.NSTATV == recorded.NSTATV );
+        BOOST_TEST( std::string( call.CMNAME ) == recorded.CMNAME );
+        BOOST_TEST( std::vector< double >( call.STRESS, call.STRESS + NTENS ) == recorded.STRESS, boost::test_tools::per_element( ) );
+        BOOST_TEST( std::vector< double >( call.STATEV, call.STATEV + call.NSTATV ) == recorded.STATEV, boost::test_tools::per_element( ) );
+        BOOST_TEST( std::vector< double >( call.DDSDDE, call.DDSDDE + NTENS * NTENS ) == recorded.DDSDDE, boost::test_tools::per_element( ) );
+        BOOST_TEST( std::vector< double >( call.STRAN, call.STRAN + NTENS ) == recorded.STRAN, boost::test_tools::per_element( ) );
+        BOOST_TEST( std::vector< double >( call.DSTRAN, call.DSTRAN + NTENS ) == recorded.DSTRAN, boost::test_tools::per_element( ) );
+
+        // The model updates the copies, not the mapped trace
+        std::array< double, 9 > stress;
+        tardigradeAbaqusTools::ColumnMajorView< double > STRESS( call.STRESS, NTENS, 1 );
+        tardigradeAbaqusTools::expandFullNTENSTensor( stress, STRESS, call.NDI, call.NSHR );
+        for ( double &value : stress ){
+            value *= 2;
+        }
+        tardigradeAbaqusTools::contractFullNTENSTensor( STRESS, stress, call.NDI, call.NSHR );
+        call.STATEV[ 0 ] = -1;
+        BOOST_TEST( call.STRESS[ 0 ] == 2 * recorded.STRESS[ 0 ] );
+        index++;
+    } );
+    BOOST_TEST( index == calls.size( ) );
+
+    BOOST_TEST( trace[ 0 ].STRESS[ 0 ] == calls[ 0 ].STRESS[ 0 ] );
+    BOOST_TEST( trace[ 0 ].STATEV[ 0 ] == calls[ 0 ].STATEV[ 0 ] );
+
+    std::remove( filename.c_str( ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( testRecordUMAT ){
+    /*!
+     * Test recording through the recorder enabled by the TARDIGRADE_ABAQUS_TOOLS_TRACE_FILE environment variable
+     */
+
+    const std::string pattern = temporaryFile( "environment_%p" );
+    const std::string filename = tardigradeAbaqusTools::processTraceFilename( pattern );
+    ::setenv( "TARDIGRADE_ABAQUS_TOOLS_TRACE_FILE", pattern.c_str( ), 1 );
+
+    const RecordedCall call( 3, 3, 2, "STEEL", 1 );
+    tardigradeAbaqusTools::recordUMAT( call.STRESS.data( ), call.STATEV.data( ), call.DDSDDE.data( ), call.STRAN.data( ),
+                                       call.DSTRAN.data( ), call.NDI, call.NSHR, call.NSTATV, call.CMNAME.data( ),
+                                       call.CMNAME.size( ) );
+
+    tardigradeAbaqusTools::UMATRecorder *recorder = tardigradeAbaqusTools::environmentRecorder( );
+    BOOST_REQUIRE( recorder != nullptr );
+    BOOST_TEST( recorder->filename( ) == filename );
+    BOOST_TEST( recorder->records( ) == 1 );
+    recorder->flush( );
+    BOOST_TEST( recorder->good( ) );
+
+    const tardigradeAbaqusTools::UMATTrace trace( filename );
+    BOOST_TEST( trace.size( ) == 1 );
+    BOOST_TEST( std::string( trace[ 0 ].CMNAME ) == "STEEL" );
+
+    std::remove( filename.c_str( ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( testProcessTraceFilename ){
+    /*!
+     * Test the per process trace file names and the latched write failures
+     */
+
+    BOOST_TEST( tardigradeAbaqusTools::processTraceFilename( "job.%p.trace", 42 ) == "job.42.trace" );
+    BOOST_TEST( tardigradeAbaqusTools::processTraceFilename( "job.trace", 42 ) == "job.trace.42" );
+    BOOST_TEST( tardigradeAbaqusTools::processTraceFilename( "job.trace" ) == "job.trace." + std::to_string( ::getpid( ) ) );
+
+    //A full device fails the writes without throwing through the UMAT
+    tardigradeAbaqusTools::UMATRecorder recorder( "/dev/full" );
+    const RecordedCall call( 3, 3, 2, "STEEL", 1 );
+    recorder.record( call.STRESS.data( ), call.STATEV.data( ), call.DDSDDE.data( ), call.STRAN.data( ), call.DSTRAN.data( ),
+                     call.NDI, call.NSHR, call.NSTATV, call.CMNAME.data( ), call.CMNAME.size( ) );
+    recorder.flush( );
+    BOOST_TEST( !recorder.good( ) );
+    recorder.record( call.STRESS.data( ), call.STATEV.data( ), call.DDSDDE.data( ), call.STRAN.data( ), call.DSTRAN.data( ),
+                     call.NDI, call.NSHR, call.NSTATV, call.CMNAME.data( ), call.CMNAME.size( ) );
+    BOOST_TEST( recorder.records( ) == 1 );
+
+    //A trace file that cannot be opened disables recording instead of throwing through the UMAT
+    BOOST_TEST( !tardigradeAbaqusTools::openTraceRecorder( nullptr ) );
+    BOOST_TEST( !tardigradeAbaqusTools::openTraceRecorder( "/nonexistent/directory/job.%p.trace" ) );
+    const std::unique_ptr< tardigradeAbaqusTools::UMATRecorder > opened =
+        tardigradeAbaqusTools::openTraceRecorder( temporaryFile( "opened_%p" ).c_str( ) );
+    BOOST_REQUIRE( opened );
+    BOOST_TEST( opened->good( ) );
+    std::remove( opened->filename( ).c_str( ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( testVUMATTraceRoundTrip ){
+    /*!
+     * Test recording, reading, and replaying VUMAT blocks of several element types
+     */
+
+    const std::string filename = temporaryFile( "vumat_round_trip" );
+    const std::vector< RecordedBlock > calls = { RecordedBlock( 4, 3, 3, 2, "STEEL   ", 1 ),
+                                                 RecordedBlock( 3, 2, 1, 0, "PLANE STRESS", 1000 ),
+                                                 RecordedBlock( 5, 3, 1, 3, "AXI", 2000 ) };
+    {
+        tardigradeAbaqusTools::VUMATRecorder recorder( filename );
+        for ( const RecordedBlock &call : calls ){
+            call.record( recorder );
+        }
+        BOOST_TEST( recorder.records( ) == calls.size( ) );
+        BOOST_TEST( recorder.good( ) );
+    }
+
+    BOOST_TEST( tardigradeAbaqusTools::isVUMATTrace( filename ) );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::UMATTrace{ filename }, std::runtime_error );
+
+    const tardigradeAbaqusTools::VUMATTrace trace( filename );
+    BOOST_TEST( trace.size( ) == calls.size( ) );
+
+    for ( std::size_t index = 0; index < calls.size( ); index++ ){
+        const RecordedBlock &call = calls[ index ];
+        const tardigradeAbaqusTools::VUMATTraceRecord record = trace[ index ];
+        const int size = call.nblock * record.ntens( );
+
+        BOOST_TEST( record.nblock == call.nblock );
+        BOOST_TEST( record.ndir == call.ndir );
+        BOOST_TEST( record.nshr == call.nshr );
+        BOOST_TEST( record.nstatev == call.nstatev );
+        BOOST_TEST( std::string( record.cmname ) == std::string( tardigradeAbaqusTools::FtoStringView( call.cmname.size( ), call.cmname.data( ) ) ) );
+        BOOST_TEST( reinterpret_cast< std::uintptr_t >( record.stressOld ) % alignof( double ) == 0 );
+
+        BOOST_TEST( std::vector< double >( record.stressOld, record.stressOld + size ) == call.stressOld, boost::test_tools::per_element( ) );
+        BOOST_TEST( std::vector< double >( record.stateOld, record.stateOld + call.nblock * call.nstatev ) == call.stateOld, boost::test_tools::per_element( ) );
+        BOOST_TEST( std::vector< double >( record.strainInc, record.strainInc + size ) == call.strainInc, boost::test_tools::per_element( ) );
+    }
+
+    //The new blocks start as copies of the old blocks and are written without touching the mapped trace
+    std::size_t index = 0;
+    tardigradeAbaqusTools::replayVUMATTrace( trace, [ & ]( tardigradeAbaqusTools::VUMATReplayCall &call ){
+        const RecordedBlock &recorded = calls[ index ];
+        const int size = call.nblock * ( call.ndir + call.nshr );
+        BOOST_TEST( call.nblock == recorded.nblock );
+        BOOST_TEST( std::string( call.cmname ) == std::string( tardigradeAbaqusTools::FtoStringView( recorded.cmname.size( ), recorded.cmname.data( ) ) ) );
+        BOOST_TEST( std::vector< double >( call.stressNew, call.stressNew + size ) == recorded.stressOld, boost::test_tools::per_element( ) );
+        BOOST_TEST( std::vector< double >( call.stateNew, call.stateNew + call.nblock * call.nstatev ) == recorded.stateOld, boost::test_tools::per_element( ) );
+        BOOST_TEST( std::vector< double >( call.strainInc, call.strainInc + size ) == recorded.strainInc, boost::test_tools::per_element( ) );
+        call.stressNew[ 0 ] = -1;
+        index++;
+    } );
+    BOOST_TEST( index == calls.size( ) );
+    BOOST_TEST( trace[ 0 ].stressOld[ 0 ] == calls[ 0 ].stressOld[ 0 ] );
+
+    //Truncated traces
+    std::filesystem::resize_file( filename, std::filesystem::file_size( filename ) - sizeof( double ) );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::VUMATTrace{ filename }, std::runtime_error );
+    std::filesystem::resize_file( filename, sizeof( tardigradeAbaqusTools::UMATTraceFileHeader ) );
+    BOOST_TEST( tardigradeAbaqusTools::VUMATTrace( filename ).size( ) == 0 );
+
+    std::remove( filename.c_str( ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( testRecordVUMAT ){
+    /*!
+     * Test recording VUMAT blocks through the recorder enabled by the TARDIGRADE_ABAQUS_TOOLS_TRACE_FILE environment
+     * variable
+     */
+
+    const std::string pattern = temporaryFile( "vumat_environment_%p" );
+    const std::string filename = tardigradeAbaqusTools::processTraceFilename( pattern );
+    ::setenv( "TARDIGRADE_ABAQUS_TOOLS_TRACE_FILE", pattern.c_str( ), 1 );
+
+    const RecordedBlock call( 8, 3, 3, 2, "STEEL", 1 );
+    tardigradeAbaqusTools::recordVUMAT( call.stressOld.data( ), call.stateOld.data( ), call.strainInc.data( ), call.nblock,
+                                        call.ndir, call.nshr, call.nstatev, call.cmname.data( ), call.cmname.size( ) );
+
+    tardigradeAbaqusTools::VUMATRecorder *recorder = tardigradeAbaqusTools::environmentVUMATRecorder( );
+    BOOST_REQUIRE( recorder != nullptr );
+    BOOST_TEST( recorder->filename( ) == filename );
+    BOOST_TEST( recorder->records( ) == 1 );
+    recorder->flush( );
+
+    const tardigradeAbaqusTools::VUMATTrace trace( filename );
+    BOOST_TEST( trace.size( ) == 1 );
+    BOOST_TEST( trace[ 0 ].nblock == 8 );
+
+    std::remove( filename.c_str( ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( testSnapshotRoundTrip ){
+    /*!
+     * Test writing columnar and point major blocks to a snapshot and reading them back
+     */
+
+    const std::string filename = temporaryFile( "snapshot" );
+    const int NDI = 3;
+    const int NSHR = 3;
+    const int NTENS = NDI + NSHR;
+    const int NSTATV = 4;
+
+    // A VUMAT block: stressNew( nblock, NTENS ) and stateNew( nblock, NSTATV )
+    const int nblock = 5;
+    const std::vector< double > stress_block = sequence( nblock * NTENS, 1 );
+    const std::vector< double > state_block = sequence( nblock * NSTATV, 100 );
+
+    // Gathered UMAT points: STRESS( NTENS, NPT ) and STATEV( NSTATV, NPT )
+    const int npoints = 3;
+    const std::vector< double > STRESS = sequence( npoints * NTENS, 200 );
+    const std::vector< double > STATEV = sequence( npoints * NSTATV, 300 );
+
+    {
+        tardigradeAbaqusTools::SnapshotWriter writer( filename, NDI, NSHR, NSTATV, tardigradeAbaqusTools::AbaqusSolver::Explicit );
+        writer.writeBlock( stress_block.data( ), state_block.data( ), nblock );
+        writer.writePoints( STRESS.data( ), STATEV.data( ), npoints );
+        writer.writeBlock( nullptr, nullptr, 0 );
+        BOOST_TEST( writer.npoints( ) == nblock + npoints );
+    }
+
+    const tardigradeAbaqusTools::SnapshotReader snapshot( filename );
+    BOOST_TEST( snapshot.NDI( ) == NDI );
+    BOOST_TEST( snapshot.NSHR( ) == NSHR );
+    BOOST_TEST( snapshot.NTENS( ) == NTENS );
+    BOOST_TEST( snapshot.NSTATV( ) == NSTATV );
+    BOOST_TEST( ( snapshot.solver( ) == tardigradeAbaqusTools::AbaqusSolver::Explicit ) );
+    BOOST_TEST( snapshot.npoints( ) == nblock + npoints );
+    BOOST_TEST( snapshot.size( ) == 3 );
+
+    const tardigradeAbaqusTools::SnapshotChunk block = snapshot[ 0 ];
+    BOOST_TEST( block.first_point == 0 );
+    BOOST_TEST( block.npoints( ) == nblock );
+    BOOST_TEST( std::vector< double >( block.stress.data( ), block.stress.data( ) + block.stress.size( ) ) == stress_block,
+                boost::test_tools::per_element( ) );
+    BOOST_TEST( std::vector< double >( block.state.data( ), block.state.data( ) + block.state.size( ) ) == state_block,
+                boost::test_tools::per_element( ) );
+
+    const tardigradeAbaqusTools::SnapshotChunk points = snapshot[ 1 ];
+    BOOST_TEST( points.first_point == nblock );
+    BOOST_TEST( points.npoints( ) == npoints );
+    for ( int point = 0; point < npoints; point++ ){
+        for ( int component = 0; component < NTENS; component++ ){
+            BOOST_TEST( points.stress( point, component ) == STRESS[ NTENS * point + component ] );
+        }
+        for ( int variable = 0; variable < NSTATV; variable++ ){
+            BOOST_TEST( points.state( point, variable ) == STATEV[ NSTATV * point + variable ] );
+        }
+    }
+
+    BOOST_TEST( snapshot[ 2 ].npoints( ) == 0 );
+
+    BOOST_TEST( snapshot.findChunk( 0 ) == 0 );
+    BOOST_TEST( snapshot.findChunk( nblock - 1 ) == 0 );
+    BOOST_TEST( snapshot.findChunk( nblock ) == 1 );
+    BOOST_TEST( snapshot.findChunk( nblock + npoints - 1 ) == 1 );
+    BOOST_CHECK_THROW( snapshot.findChunk( nblock + npoints ), std::out_of_range );
+
+    const std::vector< double > point_stress( STRESS.begin( ) + NTENS, STRESS.begin( ) + 2 * NTENS );
+    const std::vector< double > answer = tardigradeAbaqusTools::expandFullNTENSTensor( point_stress, NDI, NSHR, false );
+    const std::array< double, 9 > result = snapshot.stressTensor( nblock + 1 );
+    BOOST_TEST( std::vector< double >( result.begin( ), result.end( ) ) == answer, boost::test_tools::per_element( ) );
+
+    std::remove( filename.c_str( ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( testSnapshotErrors ){
+    /*!
+     * Test the rejection of invalid snapshot arguments and files
+     */
+
+    const std::string filename = temporaryFile( "snapshot_errors" );
+
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::SnapshotWriter( filename, 3, 3, -1 ), std::invalid_argument );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::SnapshotWriter( filename, 4, 3, 1 ), std::invalid_argument );
+
+    {
+        tardigradeAbaqusTools::UMATRecorder recorder( filename );
+    }
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::SnapshotReader{ filename }, std::runtime_error );
+
+    const std::vector< double > stress = sequence( 2 * 4, 1 );
+    const std::vector< double > state = sequence( 2 * 3, 10 );
+    {
+        tardigradeAbaqusTools::SnapshotWriter writer( filename, 3, 1, 3 );
+        writer.writeBlock( stress.data( ), state.data( ), 2 );
+    }
+    const std::size_t size = std::filesystem::file_size( filename );
+    BOOST_TEST( tardigradeAbaqusTools::SnapshotReader( filename ).npoints( ) == 2 );
+
+    std::filesystem::resize_file( filename, size - sizeof( double ) );
+    BOOST_CHECK_THROW( tardigradeAbaqusTools::SnapshotReader{ filename }, std::runtime_error );
+
+    std::remove( filename.c_str( ) );
+
+}